@@ -34,6 +34,13 @@ namespace mb
 		static_assert(sizeof(T) == 0, "No specialization of from_csv_row found");
 	}
 
+	// Types that can decode a line without building a csv_row specialise this, everything else goes through from_csv_row
+	template<typename T>
+	T from_csv_line(std::string_view line)
+	{
+		return from_csv_row<T>(parse_row(line));
+	}
+
 	template<typename T>
 	csv_row to_csv_row(const T& data)
 	{
@@ -44,10 +51,9 @@ namespace mb
 	std::vector<T> read_csv_file(const std::filesystem::path& path)
 	{
 		std::vector<T> result;
-		stream_file(path, [&result](std::string_view line)
+		stream_mapped_file(path, [&result](std::string_view line)
 			{
-				csv_row row{ parse_row(line) };
-				result.emplace_back(from_csv_row<T>(row));
+				result.emplace_back(from_csv_line<T>(line));
 			});
 
 		return result;
@@ -57,10 +63,9 @@ namespace mb
 	std::vector<T> read_csv_file(const std::filesystem::path& path, RowSelector rowSelector)
 	{
 		std::vector<T> result;
-		stream_file(path, [&result, &rowSelector](std::string_view line)
+		stream_mapped_file(path, [&result, &rowSelector](std::string_view line)
 			{
-				csv_row row{ parse_row(line) };
-				T item = from_csv_row<T>(row);
+				T item = from_csv_line<T>(line);
 
 				if (rowSelector(item))
 				{
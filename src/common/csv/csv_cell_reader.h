@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cctype>
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "common/exceptions/mb_exception.h"
+
+namespace mb
+{
+	// Walks the cells of one CSV line in place. Cells are views into the line and numbers are parsed
+	// straight from them, so decoding a row does not allocate
+	class csv_cell_reader
+	{
+	private:
+		static constexpr char SEPARATOR = ',';
+
+		std::string_view _remaining;
+		bool _finished;
+
+	public:
+		explicit csv_cell_reader(std::string_view line) noexcept
+			: _remaining{ line }, _finished{ false }
+		{}
+
+		bool has_next() const noexcept { return !_finished; }
+
+		std::string_view next() noexcept
+		{
+			size_t separator{ _remaining.find(SEPARATOR) };
+
+			if (separator == std::string_view::npos)
+			{
+				_finished = true;
+				return std::exchange(_remaining, std::string_view{});
+			}
+
+			std::string_view cell{ _remaining.substr(0, separator) };
+			_remaining.remove_prefix(separator + 1);
+
+			return cell;
+		}
+
+		template<typename Number>
+		Number next_as()
+		{
+			if (_finished)
+			{
+				throw mb_exception{ "CSV row has too few cells" };
+			}
+
+			std::string_view cell{ next() };
+			std::string_view number{ cell };
+
+			// Accept what std::stod and std::stoll do, which from_chars alone rejects
+			while (!number.empty() && std::isspace(static_cast<unsigned char>(number.front())))
+			{
+				number.remove_prefix(1);
+			}
+
+			if (number.size() > 1 && number.front() == '+' && number[1] != '-')
+			{
+				number.remove_prefix(1);
+			}
+
+			Number value;
+			auto [end, error] = std::from_chars(number.data(), number.data() + number.size(), value);
+
+			if (error != std::errc{} || end == number.data())
+			{
+				throw mb_exception{ "Could not parse CSV cell '" + std::string{ cell } + "' as a number" };
+			}
+
+			return value;
+		}
+	};
+}
@@ -49,7 +49,7 @@ namespace mb
 	{
 		std::vector<std::string> cells;
 		std::string cell;
-		std::stringstream lineStream{ line.data() };
+		std::stringstream lineStream{ std::string{ line } };
 
 		while (std::getline(lineStream, cell, ','))
 		{
@@ -4,6 +4,10 @@
 #include <iostream>
 #include <fstream>
 #include <filesystem>
+#include <string_view>
+#include <type_traits>
+
+#include "mapped_file.h"
 
 namespace mb
 {
@@ -41,4 +45,53 @@ namespace mb
 			onNewLine(line);
 		}
 	}
+
+	// Views each line of content in place, skipping blank lines and a trailing '\r'. When onNewLine returns a bool,
+	// returning false stops at that line
+	template<typename OnNewLine>
+	void stream_lines(std::string_view content, OnNewLine onNewLine)
+	{
+		while (!content.empty())
+		{
+			size_t lineEnd{ content.find('\n') };
+			std::string_view line{ content.substr(0, lineEnd) };
+			content.remove_prefix(lineEnd == std::string_view::npos ? content.size() : lineEnd + 1);
+
+			if (!line.empty() && line.back() == '\r')
+			{
+				line.remove_suffix(1);
+			}
+
+			if (line.empty())
+			{
+				continue;
+			}
+
+			if constexpr (std::is_same_v<std::invoke_result_t<OnNewLine&, std::string_view>, bool>)
+			{
+				if (!onNewLine(line))
+				{
+					return;
+				}
+			}
+			else
+			{
+				onNewLine(line);
+			}
+		}
+	}
+
+	// Views each line of the file in place through a memory mapping. Like stream_file, a file that does not exist
+	// has no lines
+	template<typename OnNewLine>
+	void stream_mapped_file(const std::filesystem::path& path, OnNewLine onNewLine)
+	{
+		if (!std::filesystem::exists(path))
+		{
+			return;
+		}
+
+		mapped_file file{ path };
+		stream_lines(std::string_view{ reinterpret_cast<const char*>(file.data()), file.size() }, std::move(onNewLine));
+	}
 }
\ No newline at end of file
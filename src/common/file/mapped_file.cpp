@@ -0,0 +1,158 @@
+#if _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <fmt/format.h>
+#include <utility>
+
+#include "mapped_file.h"
+#include "common/exceptions/mb_exception.h"
+
+namespace mb
+{
+#if _WIN32
+	mapped_file::mapped_file(const std::filesystem::path& path)
+		: _data{ nullptr }, _size{ 0 }, _fileHandle{ INVALID_HANDLE_VALUE }, _mappingHandle{ NULL }
+	{
+		// Sharing delete access lets a converter replace the file by renaming over it while it is mapped here
+		_fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+		if (_fileHandle == INVALID_HANDLE_VALUE)
+		{
+			throw mb_exception{ fmt::format("Could not open file {}", path.string()) };
+		}
+
+		LARGE_INTEGER fileSize;
+		GetFileSizeEx(_fileHandle, &fileSize);
+		_size = static_cast<size_t>(fileSize.QuadPart);
+
+		if (_size == 0)
+		{
+			return;
+		}
+
+		_mappingHandle = CreateFileMappingW(_fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+		void* view = _mappingHandle == NULL ? NULL : MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+		if (view == NULL)
+		{
+			unmap();
+			throw mb_exception{ fmt::format("Could not map file {}", path.string()) };
+		}
+
+		_data = static_cast<const std::byte*>(view);
+	}
+
+	void mapped_file::unmap() noexcept
+	{
+		if (_data != nullptr)
+		{
+			UnmapViewOfFile(_data);
+		}
+
+		if (_mappingHandle != NULL)
+		{
+			CloseHandle(_mappingHandle);
+		}
+
+		if (_fileHandle != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(_fileHandle);
+		}
+
+		_data = nullptr;
+		_size = 0;
+		_mappingHandle = NULL;
+		_fileHandle = INVALID_HANDLE_VALUE;
+	}
+
+	mapped_file::mapped_file(mapped_file&& other) noexcept
+		:
+		_data{ std::exchange(other._data, nullptr) },
+		_size{ std::exchange(other._size, 0) },
+		_fileHandle{ std::exchange(other._fileHandle, INVALID_HANDLE_VALUE) },
+		_mappingHandle{ std::exchange(other._mappingHandle, NULL) }
+	{}
+
+	mapped_file& mapped_file::operator=(mapped_file&& other) noexcept
+	{
+		std::swap(_data, other._data);
+		std::swap(_size, other._size);
+		std::swap(_fileHandle, other._fileHandle);
+		std::swap(_mappingHandle, other._mappingHandle);
+
+		return *this;
+	}
+#else
+	mapped_file::mapped_file(const std::filesystem::path& path)
+		: _data{ nullptr }, _size{ 0 }
+	{
+		int fileDescriptor = open(path.c_str(), O_RDONLY);
+
+		if (fileDescriptor == -1)
+		{
+			throw mb_exception{ fmt::format("Could not open file {}", path.string()) };
+		}
+
+		struct stat fileStatus;
+		if (fstat(fileDescriptor, &fileStatus) == -1)
+		{
+			close(fileDescriptor);
+			throw mb_exception{ fmt::format("Could not read size of file {}", path.string()) };
+		}
+
+		_size = static_cast<size_t>(fileStatus.st_size);
+
+		if (_size != 0)
+		{
+			void* view = mmap(nullptr, _size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+
+			if (view == MAP_FAILED)
+			{
+				close(fileDescriptor);
+				throw mb_exception{ fmt::format("Could not map file {}", path.string()) };
+			}
+
+			_data = static_cast<const std::byte*>(view);
+		}
+
+		// The mapping keeps its own reference to the file
+		close(fileDescriptor);
+	}
+
+	void mapped_file::unmap() noexcept
+	{
+		if (_data != nullptr)
+		{
+			munmap(const_cast<std::byte*>(_data), _size);
+		}
+
+		_data = nullptr;
+		_size = 0;
+	}
+
+	mapped_file::mapped_file(mapped_file&& other) noexcept
+		:
+		_data{ std::exchange(other._data, nullptr) },
+		_size{ std::exchange(other._size, 0) }
+	{}
+
+	mapped_file& mapped_file::operator=(mapped_file&& other) noexcept
+	{
+		std::swap(_data, other._data);
+		std::swap(_size, other._size);
+
+		return *this;
+	}
+#endif
+
+	mapped_file::~mapped_file()
+	{
+		unmap();
+	}
+}
\ No newline at end of file
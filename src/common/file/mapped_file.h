@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+
+namespace mb
+{
+	// Read-only view of a whole file mapped into memory. Pages are loaded on first access and the
+	// operating system shares them between every process that maps the same file
+	class mapped_file
+	{
+	private:
+		const std::byte* _data;
+		size_t _size;
+
+#if _WIN32
+		void* _fileHandle;
+		void* _mappingHandle;
+#endif
+
+		void unmap() noexcept;
+
+	public:
+		explicit mapped_file(const std::filesystem::path& path);
+		~mapped_file();
+
+		mapped_file(const mapped_file&) = delete;
+		mapped_file& operator=(const mapped_file&) = delete;
+
+		mapped_file(mapped_file&& other) noexcept;
+		mapped_file& operator=(mapped_file&& other) noexcept;
+
+		const std::byte* data() const noexcept { return _data; }
+		size_t size() const noexcept { return _size; }
+	};
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <utility>
+#include <string_view>
+#include <stdexcept>
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+namespace mb
+{
+    class hmac_digest
+    {
+    private:
+        std::array<unsigned char, EVP_MAX_MD_SIZE> _bytes;
+        unsigned int _length;
+
+    public:
+        hmac_digest()
+            : _bytes{}, _length{ 0 }
+        {}
+
+        unsigned char* data() noexcept { return _bytes.data(); }
+        const unsigned char* data() const noexcept { return _bytes.data(); }
+        unsigned int size() const noexcept { return _length; }
+        unsigned int& length() noexcept { return _length; }
+
+        const unsigned char* begin() const noexcept { return _bytes.data(); }
+        const unsigned char* end() const noexcept { return _bytes.data() + _length; }
+
+        std::string_view as_string_view() const noexcept { return std::string_view{ reinterpret_cast<const char*>(_bytes.data()), _length }; }
+    };
+
+    // Fixed size character buffer for an encoded digest, large enough for Base64 of a SHA-512 HMAC
+    class encoded_digest
+    {
+    private:
+        std::array<char, 4 * ((EVP_MAX_MD_SIZE + 2) / 3) + 1> _characters;
+        size_t _length;
+
+    public:
+        encoded_digest()
+            : _characters{}, _length{ 0 }
+        {}
+
+        char* data() noexcept { return _characters.data(); }
+        size_t& length() noexcept { return _length; }
+
+        std::string_view view() const noexcept { return std::string_view{ _characters.data(), _length }; }
+        std::string to_string() const { return std::string{ view() }; }
+    };
+
+    inline encoded_digest hex_encode(const hmac_digest& digest) noexcept
+    {
+        constexpr std::string_view HEX_CHARACTERS = "0123456789abcdef";
+
+        encoded_digest encoded;
+        char* output = encoded.data();
+
+        for (unsigned char value : digest)
+        {
+            *output++ = HEX_CHARACTERS[value >> 4];
+            *output++ = HEX_CHARACTERS[value & 0x0F];
+        }
+
+        encoded.length() = digest.size() * 2;
+        return encoded;
+    }
+
+    inline encoded_digest b64_encode(const hmac_digest& digest) noexcept
+    {
+        encoded_digest encoded;
+        encoded.length() = EVP_EncodeBlock(reinterpret_cast<unsigned char*>(encoded.data()), digest.data(), digest.size());
+
+        return encoded;
+    }
+
+    // Holds an HMAC context that has already been keyed, so signing a request only clones that
+    // state and hashes the message. The clone target is reused per thread, so nothing is allocated
+    class hmac_signer
+    {
+    private:
+        HMAC_CTX* _keyedContext;
+
+        static HMAC_CTX* thread_context()
+        {
+            struct context_holder
+            {
+                HMAC_CTX* context = HMAC_CTX_new();
+                ~context_holder() { HMAC_CTX_free(context); }
+            };
+
+            thread_local context_holder holder;
+            return holder.context;
+        }
+
+        void update(HMAC_CTX* context, std::string_view part) const
+        {
+            HMAC_Update(context, reinterpret_cast<const unsigned char*>(part.data()), part.size());
+        }
+
+    public:
+        template<typename Key>
+        hmac_signer(const Key& key, const EVP_MD* hashAlgorithm)
+            : _keyedContext{ HMAC_CTX_new() }
+        {
+            if (_keyedContext == nullptr)
+            {
+                throw std::runtime_error("cannot create HMAC_CTX");
+            }
+
+            // An empty key still needs a non-null pointer, otherwise OpenSSL treats it as "reuse the previous key"
+            static const unsigned char emptyKey = 0;
+            const void* keyData = key.size() == 0 ? &emptyKey : static_cast<const void*>(key.data());
+
+            if (!HMAC_Init_ex(_keyedContext, keyData, static_cast<int>(key.size()), hashAlgorithm, NULL))
+            {
+                HMAC_CTX_free(_keyedContext);
+                throw std::runtime_error("cannot initialise HMAC_CTX");
+            }
+        }
+
+        ~hmac_signer()
+        {
+            HMAC_CTX_free(_keyedContext);
+        }
+
+        hmac_signer(const hmac_signer&) = delete;
+        hmac_signer& operator=(const hmac_signer&) = delete;
+
+        hmac_signer(hmac_signer&& other) noexcept
+            : _keyedContext{ other._keyedContext }
+        {
+            other._keyedContext = nullptr;
+        }
+
+        hmac_signer& operator=(hmac_signer&& other) noexcept
+        {
+            std::swap(_keyedContext, other._keyedContext);
+            return *this;
+        }
+
+        // Signs the concatenation of every part without building the message first
+        template<typename... Parts>
+        hmac_digest sign(const Parts&... parts) const
+        {
+            HMAC_CTX* context = thread_context();
+
+            if (context == nullptr || !HMAC_CTX_copy(context, _keyedContext))
+            {
+                throw std::runtime_error("cannot copy HMAC_CTX");
+            }
+
+            (update(context, std::string_view{ parts }), ...);
+
+            hmac_digest digest;
+            HMAC_Final(context, digest.data(), &digest.length());
+
+            return digest;
+        }
+    };
+
+    template<typename Key>
+    hmac_signer create_hmac_sha256_signer(const Key& key)
+    {
+        return hmac_signer{ key, EVP_sha256() };
+    }
+
+    template<typename Key>
+    hmac_signer create_hmac_sha512_signer(const Key& key)
+    {
+        return hmac_signer{ key, EVP_sha512() };
+    }
+}
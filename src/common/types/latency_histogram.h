@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+
+namespace mb
+{
+	class latency_summary
+	{
+	private:
+		long long _sampleCount;
+		std::chrono::microseconds _last;
+		std::chrono::microseconds _median;
+		std::chrono::microseconds _p99;
+		std::chrono::microseconds _max;
+
+	public:
+		constexpr latency_summary()
+			: latency_summary{ 0, {}, {}, {}, {} }
+		{}
+
+		constexpr latency_summary(
+			long long sampleCount,
+			std::chrono::microseconds last,
+			std::chrono::microseconds median,
+			std::chrono::microseconds p99,
+			std::chrono::microseconds max)
+			:
+			_sampleCount{ sampleCount },
+			_last{ last },
+			_median{ median },
+			_p99{ p99 },
+			_max{ max }
+		{}
+
+		constexpr long long sample_count() const noexcept { return _sampleCount; }
+		constexpr std::chrono::microseconds last() const noexcept { return _last; }
+		constexpr std::chrono::microseconds median() const noexcept { return _median; }
+		constexpr std::chrono::microseconds p99() const noexcept { return _p99; }
+		constexpr std::chrono::microseconds max() const noexcept { return _max; }
+	};
+
+	// Bucket i counts samples in [2^(i-1), 2^i) microseconds so percentiles are accurate to a factor of two
+	class latency_histogram
+	{
+	private:
+		static constexpr int BUCKET_COUNT = 40;
+
+		std::array<std::atomic<long long>, BUCKET_COUNT> _buckets;
+		std::atomic<long long> _sampleCount;
+		std::atomic<long long> _last;
+		std::atomic<long long> _max;
+
+		static constexpr int bucket_index(long long microseconds) noexcept
+		{
+			int index = 0;
+
+			while (microseconds > 0 && index < BUCKET_COUNT - 1)
+			{
+				microseconds >>= 1;
+				++index;
+			}
+
+			return index;
+		}
+
+	public:
+		latency_histogram()
+			: _buckets{}, _sampleCount{ 0 }, _last{ 0 }, _max{ 0 }
+		{}
+
+		void record(std::chrono::microseconds latency) noexcept
+		{
+			long long value{ latency.count() < 0 ? 0 : latency.count() };
+
+			_buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+			_last.store(value, std::memory_order_relaxed);
+
+			long long currentMax{ _max.load(std::memory_order_relaxed) };
+			while (value > currentMax && !_max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed));
+
+			_sampleCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		long long sample_count() const noexcept { return _sampleCount.load(std::memory_order_relaxed); }
+		std::chrono::microseconds last() const noexcept { return std::chrono::microseconds{ _last.load(std::memory_order_relaxed) }; }
+		std::chrono::microseconds max() const noexcept { return std::chrono::microseconds{ _max.load(std::memory_order_relaxed) }; }
+
+		std::chrono::microseconds percentile(double percentile) const noexcept
+		{
+			std::array<long long, BUCKET_COUNT> counts;
+			long long total = 0;
+
+			for (int i = 0; i < BUCKET_COUNT; ++i)
+			{
+				counts[i] = _buckets[i].load(std::memory_order_relaxed);
+				total += counts[i];
+			}
+
+			if (total == 0)
+			{
+				return std::chrono::microseconds{ 0 };
+			}
+
+			long long rank{ static_cast<long long>(percentile / 100.0 * total) };
+			long long seen = 0;
+			long long maxValue{ _max.load(std::memory_order_relaxed) };
+
+			for (int i = 0; i < BUCKET_COUNT; ++i)
+			{
+				seen += counts[i];
+
+				if (seen > rank)
+				{
+					long long upperBound{ i == 0 ? 0 : (1LL << i) - 1 };
+					return std::chrono::microseconds{ std::min(upperBound, maxValue) };
+				}
+			}
+
+			return std::chrono::microseconds{ maxValue };
+		}
+
+		latency_summary summarise() const noexcept
+		{
+			return latency_summary{ sample_count(), last(), percentile(50), percentile(99), max() };
+		}
+	};
+}
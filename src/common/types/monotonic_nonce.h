@@ -0,0 +1,43 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include "common/utils/timeutils.h"
+
+namespace mb
+{
+	// Microsecond timestamps that never repeat or go backwards, even when several threads sign requests in
+	// the same microsecond or the system clock is stepped back. Later callers are simply given last + 1
+	class monotonic_nonce
+	{
+	private:
+		std::atomic<long long> _last;
+
+	public:
+		monotonic_nonce()
+			: _last{ 0 }
+		{}
+
+		static monotonic_nonce& instance()
+		{
+			static monotonic_nonce nonce;
+			return nonce;
+		}
+
+		long long next() noexcept
+		{
+			long long now{ time_since_epoch<std::chrono::microseconds>() };
+			long long last{ _last.load(std::memory_order_relaxed) };
+			long long candidate;
+
+			do
+			{
+				candidate = now > last ? now : last + 1;
+			} 
+			while (!_last.compare_exchange_weak(last, candidate, std::memory_order_relaxed));
+
+			return candidate;
+		}
+	};
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+
+namespace mb
+{
+	// Memoises values for a fixed time to live. Concurrent lookups of a key that is still loading
+	// wait on the same load instead of starting their own, and failed loads are never cached.
+	// Expired entries are swept out whenever the number of entries doubles, so keys that are
+	// never asked for again do not hold memory for the life of the cache
+	template<typename Key, typename Value>
+	class ttl_cache
+	{
+	private:
+		using clock = std::chrono::steady_clock;
+
+		struct entry
+		{
+			std::shared_future<Value> value;
+			clock::time_point expiry;
+		};
+
+		static constexpr size_t MINIMUM_SWEEP_SIZE = 64;
+
+		std::chrono::milliseconds _timeToLive;
+		std::unordered_map<Key, entry> _entries;
+		size_t _sweepSize;
+		std::mutex _mutex;
+
+		// Called with the mutex held before an entry is added
+		void sweep_expired()
+		{
+			if (_entries.size() < _sweepSize)
+			{
+				return;
+			}
+
+			clock::time_point now{ clock::now() };
+
+			for (auto it = _entries.begin(); it != _entries.end();)
+			{
+				it = now < it->second.expiry
+					? std::next(it)
+					: _entries.erase(it);
+			}
+
+			_sweepSize = std::max(MINIMUM_SWEEP_SIZE, 2 * _entries.size());
+		}
+
+	public:
+		explicit ttl_cache(std::chrono::milliseconds timeToLive)
+			: _timeToLive{ timeToLive }, _entries{}, _sweepSize{ MINIMUM_SWEEP_SIZE }, _mutex{}
+		{}
+
+		template<typename Loader>
+		Value get(const Key& key, const Loader& loader)
+		{
+			std::promise<Value> promise;
+			std::shared_future<Value> cached;
+
+			{
+				std::lock_guard<std::mutex> lock{ _mutex };
+				auto it = _entries.find(key);
+
+				// Entries that are still loading never expire, so every caller shares the load
+				if (it != _entries.end() && clock::now() < it->second.expiry)
+				{
+					cached = it->second.value;
+				}
+				else
+				{
+					sweep_expired();
+					_entries.insert_or_assign(key, entry{ promise.get_future().share(), clock::time_point::max() });
+				}
+			}
+
+			if (cached.valid())
+			{
+				return cached.get();
+			}
+
+			try
+			{
+				Value value{ loader() };
+				promise.set_value(value);
+
+				std::lock_guard<std::mutex> lock{ _mutex };
+				auto it = _entries.find(key);
+
+				if (it != _entries.end())
+				{
+					it->second.expiry = clock::now() + _timeToLive;
+				}
+
+				return value;
+			}
+			catch (...)
+			{
+				promise.set_exception(std::current_exception());
+
+				std::lock_guard<std::mutex> lock{ _mutex };
+				_entries.erase(key);
+
+				throw;
+			}
+		}
+
+		void put(const Key& key, Value value)
+		{
+			std::promise<Value> promise;
+			promise.set_value(std::move(value));
+
+			std::lock_guard<std::mutex> lock{ _mutex };
+			sweep_expired();
+			_entries.insert_or_assign(key, entry{ promise.get_future().share(), clock::now() + _timeToLive });
+		}
+
+		size_t size()
+		{
+			std::lock_guard<std::mutex> lock{ _mutex };
+			return _entries.size();
+		}
+
+		void clear()
+		{
+			std::lock_guard<std::mutex> lock{ _mutex };
+			_entries.clear();
+		}
+	};
+}
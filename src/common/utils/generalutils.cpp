@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <thread>
+
 #include "generalutils.h"
 #include "common/exceptions/mb_exception.h"
 
@@ -10,4 +13,13 @@ namespace mb
 			throw mb_exception{ message.data() };
 		}
 	}
+
+	int resolve_thread_count(int configuredThreads, size_t workCount)
+	{
+		int threadCount{ configuredThreads == 0
+			? static_cast<int>(std::thread::hardware_concurrency())
+			: configuredThreads };
+
+		return std::max(1, std::min(threadCount, static_cast<int>(workCount)));
+	}
 }
\ No newline at end of file
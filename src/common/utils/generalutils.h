@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstddef>
 #include <string_view>
 
 namespace mb
 {
 	void assert_throw(bool condition, std::string_view message = "");
+
+	// Zero configured threads means one per hardware core. Never more threads than items of work, and always at least one
+	int resolve_thread_count(int configuredThreads, size_t workCount);
 }
\ No newline at end of file
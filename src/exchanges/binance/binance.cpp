@@ -6,6 +6,7 @@
 #include "common/file/config_file_reader.h"
 #include "common/utils/containerutils.h"
 #include "common/utils/mathutils.h"
+#include "logging/logger.h"
 
 #include "common/exceptions/not_implemented_exception.h"
 
@@ -104,6 +105,26 @@ namespace
 
 		return query;
 	}
+
+	std::string create_order_book_query(const tradable_pair& tradablePair, int depth)
+	{
+		return url_query_builder{}
+			.add_parameter("symbol", tradablePair.to_string())
+			.add_parameter("limit", std::to_string(depth))
+			.to_string();
+	}
+
+	int order_book_weight(int depth)
+	{
+		if (depth <= 100)
+			return 5;
+		if (depth <= 500)
+			return 25;
+		if (depth <= 1000)
+			return 50;
+
+		return 250;
+	}
 }
 
 namespace mb
@@ -117,13 +138,16 @@ namespace mb
 		exchange{ exchange_ids::BINANCE, websocketStream },
 		_baseUrl{ select_base_url(enableTesting) },
 		_apiKey{ std::move(config.api_key()) },
-		_secretKey{ std::move(config.secret_key()) },
-		_httpService{ std::move(httpService) }
+		_signer{ create_hmac_sha256_signer(config.secret_key()) },
+		_httpService{ std::move(httpService) },
+		// Request weight is counted per IP over a one minute window
+		_rateLimiter{ std::make_unique<rate_limiter>(rate_limit{ 6000, 100, "X-MBX-USED-WEIGHT-1M" }) },
+		_retryPolicy{ internal::create_retry_policy("/api/v3/depth") }
 	{}
 
-	std::string binance_api::compute_api_sign(std::string query) const
+	std::string binance_api::compute_api_sign(std::string_view query) const
 	{
-		return hex_encode(hmac_sha256(query, _secretKey));
+		return hex_encode(_signer.sign(query)).to_string();
 	}
 
 	exchange_status binance_api::get_status() const
@@ -133,14 +157,14 @@ namespace mb
 
 	std::vector<tradable_pair> binance_api::get_tradable_pairs() const
 	{
-		_orderFilters = send_public_request<std::unordered_map<tradable_pair, internal::binance_order_filters>>("/api/v3/exchangeInfo", binance::read_tradable_pairs);
+		std::unordered_map<tradable_pair, internal::binance_order_filters> orderFilters{ send_public_request<std::unordered_map<tradable_pair, internal::binance_order_filters>>("/api/v3/exchangeInfo", binance::read_tradable_pairs, "", 20) };
 
 		std::vector<tradable_pair> pairs;
-		pairs.reserve(_orderFilters.size());
+		pairs.reserve(orderFilters.size());
 
 		double minValue = 0.0;
 
-		for (auto& [pair, filter] : _orderFilters)
+		for (auto& [pair, filter] : orderFilters)
 		{
 			pairs.emplace_back(pair);
 
@@ -150,9 +174,55 @@ namespace mb
 			}
 		}
 
+		{
+			std::lock_guard<std::mutex> lock{ _orderFiltersMutex };
+			_orderFilters = std::move(orderFilters);
+		}
+
 		return pairs;
 	}
 
+	internal::binance_order_filters binance_api::get_order_filters(const tradable_pair& pair) const
+	{
+		bool loaded;
+
+		{
+			std::lock_guard<std::mutex> lock{ _orderFiltersMutex };
+			auto it = _orderFilters.find(pair);
+
+			if (it != _orderFilters.end())
+			{
+				return it->second;
+			}
+
+			loaded = !_orderFilters.empty();
+		}
+
+		// Filters arrive with the tradable pairs, which a warm response cache can serve without asking the exchange
+		if (!loaded)
+		{
+			try
+			{
+				get_tradable_pairs();
+			}
+			catch (const std::exception& e)
+			{
+				logger::instance().warning("Could not load Binance order filters: {}", e.what());
+			}
+
+			std::lock_guard<std::mutex> lock{ _orderFiltersMutex };
+			auto it = _orderFilters.find(pair);
+
+			if (it != _orderFilters.end())
+			{
+				return it->second;
+			}
+		}
+
+		logger::instance().warning("No Binance order filters for {}, using the defaults", pair.to_string('/'));
+		return internal::binance_order_filters{};
+	}
+
 	std::vector<ohlcv_data> binance_api::get_ohlcv(const tradable_pair& tradablePair, ohlcv_interval interval, int count) const
 	{
 		std::string query = url_query_builder{}
@@ -161,7 +231,7 @@ namespace mb
 			.add_parameter("limit", std::to_string(count))
 			.to_string();
 
-		return send_public_request<std::vector<ohlcv_data>>("/api/v3/klines", binance::read_ohlcv, query);
+		return send_public_request<std::vector<ohlcv_data>>("/api/v3/klines", binance::read_ohlcv, query, 2);
 	}
 
 	double binance_api::get_price(const tradable_pair& tradablePair) const
@@ -170,7 +240,7 @@ namespace mb
 			.add_parameter("symbol", tradablePair.to_string())
 			.to_string();
 
-		return send_public_request<double>("/api/v3/ticker/price", binance::read_price, query);
+		return send_public_request<double>("/api/v3/ticker/price", binance::read_price, query, 2);
 	}
 
 	std::unordered_map<tradable_pair, double> binance_api::get_prices(const std::vector<tradable_pair>& pairs) const
@@ -179,33 +249,36 @@ namespace mb
 			.add_parameter("symbols", create_symbols_list(pairs))
 			.to_string();
 
-		std::unordered_map<std::string, double> namedPrices{ send_public_request<std::unordered_map<std::string, double>>("/api/v3/ticker/price", binance::read_prices, query) };
+		std::unordered_map<std::string, double> namedPrices{ send_public_request<std::unordered_map<std::string, double>>("/api/v3/ticker/price", binance::read_prices, query, 4) };
 		return internal::create_pair_result_map(pairs, namedPrices);
 	}
 
 	order_book_state binance_api::get_order_book(const tradable_pair& tradablePair, int depth) const
 	{
-		std::string query = url_query_builder{}
-			.add_parameter("symbol", tradablePair.to_string())
-			.add_parameter("limit", std::to_string(depth))
-			.to_string();
+		return send_public_request<order_book_state>("/api/v3/depth", binance::read_order_book, create_order_book_query(tradablePair, depth), order_book_weight(depth));
+	}
 
-		return send_public_request<order_book_state>("/api/v3/depth", binance::read_order_book, query);
+	std::unordered_map<tradable_pair, order_book_state> binance_api::get_order_books(const std::vector<tradable_pair>& pairs, int depth) const
+	{
+		return internal::send_pair_requests<order_book_state>(pairs, [this, depth](const tradable_pair& pair)
+		{
+			return send_public_request_async<order_book_state>("/api/v3/depth", binance::read_order_book, create_order_book_query(pair, depth), order_book_weight(depth));
+		});
 	}
 
 	double binance_api::get_fee(const tradable_pair& tradablePair) const
 	{
-		return send_private_request<double>(http_verb::GET, "/api/v3/account", binance::read_fee);
+		return send_private_request<double>(http_verb::GET, "/api/v3/account", binance::read_fee, url_query_builder{}, 20);
 	}
 
 	std::unordered_map<std::string, double> binance_api::get_balances() const
 	{
-		return send_private_request<std::unordered_map<std::string, double>>(http_verb::GET, "/api/v3/account", binance::read_balances);
+		return send_private_request<std::unordered_map<std::string, double>>(http_verb::GET, "/api/v3/account", binance::read_balances, url_query_builder{}, 20);
 	}
 
 	std::vector<order_description> binance_api::get_open_orders() const
 	{
-		return send_private_request<std::vector<order_description>>(http_verb::GET, "/api/v3/openOrders", binance::read_open_orders);
+		return send_private_request<std::vector<order_description>>(http_verb::GET, "/api/v3/openOrders", binance::read_open_orders, url_query_builder{}, 80);
 	}
 
 	std::vector<order_description> binance_api::get_closed_orders() const
@@ -215,13 +288,13 @@ namespace mb
 
 	std::string binance_api::add_order(const order_request& request)
 	{
-		url_query_builder query{ create_order_query(request, _orderFilters[request.pair()])};
+		url_query_builder query{ create_order_query(request, get_order_filters(request.pair())) };
 		return send_private_request<std::string>(http_verb::POST, "/api/v3/order", binance::read_add_order, query);
 	}
 
 	order_confirmation binance_api::add_order_confirm(const order_request& request)
 	{
-		url_query_builder query{ create_order_query(request, _orderFilters[request.pair()]) };
+		url_query_builder query{ create_order_query(request, get_order_filters(request.pair())) };
 		return send_private_request<order_confirmation>(http_verb::POST, "/api/v3/order", binance::read_add_order_confirm, query);
 	}
 
@@ -251,7 +324,7 @@ namespace mb
 	}
 
 	template<>
-	std::unique_ptr<websocket_stream> create_exchange_websocket_stream<internal::binance_websocket_stream>()
+	std::unique_ptr<websocket_stream> create_exchange_websocket_stream<internal::binance_websocket_stream>(bool compression)
 	{
 		std::unique_ptr<binance_api> marketApi{ std::make_unique<binance_api>(
 			binance_config{},
@@ -260,17 +333,17 @@ namespace mb
 			false) };
 
 		return std::make_unique<internal::binance_websocket_stream>(
-			std::make_unique<websocket_connection_factory>(),
+			std::make_unique<websocket_connection_factory>(compression),
 			std::move(marketApi));
 	}
 
 	template<>
-	std::unique_ptr<exchange> create_exchange_api<binance_api>(bool testing)
+	std::unique_ptr<exchange> create_exchange_api<binance_api>(bool testing, bool websocketCompression)
 	{
 		return std::make_unique<binance_api>(
 			internal::load_or_create_config<binance_config>(),
 			std::make_unique<http_service>(),
-			create_exchange_websocket_stream<internal::binance_websocket_stream>(),
+			create_exchange_websocket_stream<internal::binance_websocket_stream>(websocketCompression),
 			testing);
 	}
 }
\ No newline at end of file
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <mutex>
+
 #include "binance_config.h"
 #include "binance_websocket.h"
 #include "binance_order_filters.h"
 #include "exchanges/exchange.h"
 #include "exchanges/exchange_common.h"
+#include "common/security/hmac_signer.h"
 #include "networking/http/http_service.h"
 #include "networking/url.h"
 #include "common/utils/timeutils.h"
@@ -14,24 +17,40 @@ namespace mb
 	class binance_api : public exchange
 	{
 	public:
-		std::string compute_api_sign(std::string query) const;
+		std::string compute_api_sign(std::string_view query) const;
 	private:
 		std::string_view _baseUrl;
 		std::string _apiKey;
-		std::string _secretKey;
+		hmac_signer _signer;
 		std::unique_ptr<http_service> _httpService;
+		std::unique_ptr<rate_limiter> _rateLimiter;
+		std::unique_ptr<retry_policy> _retryPolicy;
 		mutable std::unordered_map<tradable_pair, internal::binance_order_filters> _orderFilters;
+		mutable std::mutex _orderFiltersMutex;
+
+		// Orders are added concurrently, so filters are copied out under the lock rather than referenced. Loads
+		// the filters if get_tradable_pairs has not been called on this instance
+		internal::binance_order_filters get_order_filters(const tradable_pair& pair) const;
+
+		template<typename Value, typename ResponseReader>
+		Value send_public_request(std::string_view path, const ResponseReader& reader, std::string_view query = "", int weight = 1) const
+		{
+			http_request request{ http_verb::GET, build_url(_baseUrl, path, query) };
+			return internal::send_http_request<Value>(*_httpService, request, reader, *_rateLimiter, *_retryPolicy, weight);
+		}
 
 		template<typename Value, typename ResponseReader>
-		Value send_public_request(std::string_view path, const ResponseReader& reader, std::string_view query = "") const
+		std::future<Value> send_public_request_async(std::string_view path, ResponseReader reader, std::string_view query = "", int weight = 1) const
 		{
 			http_request request{ http_verb::GET, build_url(_baseUrl, path, query) };
-			return internal::send_http_request<Value>(*_httpService, request, reader);
+			return internal::send_http_request_async<Value>(*_httpService, request, reader, *_rateLimiter, *_retryPolicy, weight);
 		}
 
 		template<typename Value, typename ResponseReader>
-		Value send_private_request(http_verb verb, std::string_view path, const ResponseReader& reader, url_query_builder query = url_query_builder{}) const
+		Value send_private_request(http_verb verb, std::string_view path, const ResponseReader& reader, url_query_builder query = url_query_builder{}, int weight = 1) const
 		{
+			_rateLimiter->acquire(weight, internal::to_request_priority(verb));
+
 			std::string timeStamp{ std::to_string(time_since_epoch<std::chrono::milliseconds>()) };
 			query.add_parameter("timestamp", std::move(timeStamp));
 
@@ -42,7 +61,7 @@ namespace mb
 
 			request.add_header("X-MBX-APIKEY", _apiKey);
 
-			return internal::send_http_request<Value>(*_httpService, request, reader);
+			return internal::send_acquired_http_request<Value>(*_httpService, request, reader, *_rateLimiter);
 		}
 
 	public:
@@ -58,6 +77,7 @@ namespace mb
 		double get_price(const tradable_pair& tradablePair) const override;
 		std::unordered_map<tradable_pair, double> get_prices(const std::vector<tradable_pair>& pairs) const override;
 		order_book_state get_order_book(const tradable_pair& tradablePair, int depth) const override;
+		std::unordered_map<tradable_pair, order_book_state> get_order_books(const std::vector<tradable_pair>& pairs, int depth) const override;
 		double get_fee(const tradable_pair& tradablePair) const override;
 		std::unordered_map<std::string, double> get_balances() const override;
 		std::vector<order_description> get_open_orders() const override;
@@ -68,5 +88,5 @@ namespace mb
 	};
 
 	template<>
-	std::unique_ptr<exchange> create_exchange_api<binance_api>(bool testing);
+	std::unique_ptr<exchange> create_exchange_api<binance_api>(bool testing, bool websocketCompression);
 }
\ No newline at end of file
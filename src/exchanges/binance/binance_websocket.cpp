@@ -98,7 +98,15 @@ namespace mb::internal
 
 		if (!contains(_orderBookIds, symbol))
 		{
-			order_book_state snapshot{ _marketApi->get_order_book(_pairs.shared_lock()->at(symbol), 100)};
+			const tradable_pair* pair{ find_pair(symbol) };
+
+			if (!pair)
+			{
+				logger::instance().warning("Binance websocket: order book update for unsubscribed symbol '{}'", symbol);
+				return;
+			}
+
+			order_book_state snapshot{ _marketApi->get_order_book(*pair, 100) };
 			_orderBookIds[symbol] = snapshot.time_stamp();
 			initialise_order_book(symbol, from_snapshot(snapshot));
 			return;
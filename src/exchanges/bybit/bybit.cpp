@@ -44,6 +44,21 @@ namespace
 		return orderType == order_type::MARKET
 			? "MARKET" : "LIMIT";
 	}
+
+	std::string create_price_query(const tradable_pair& tradablePair)
+	{
+		return url_query_builder{}
+			.add_parameter("symbol", tradablePair.to_string())
+			.to_string();
+	}
+
+	std::string create_order_book_query(const tradable_pair& tradablePair, int depth)
+	{
+		return url_query_builder{}
+			.add_parameter("symbol", tradablePair.to_string())
+			.add_parameter("limit", std::to_string(depth))
+			.to_string();
+	}
 }
 
 namespace mb
@@ -57,9 +72,11 @@ namespace mb
 		exchange{ exchange_ids::BYBIT, std::move(websocketStream) },
 		_baseUrl{ select_base_url(enableTesting) },
 		_apiKey{ config.api_key() },
-		_apiSecret{ config.api_secret() },
+		_signer{ create_hmac_sha256_signer(config.api_secret()) },
 		_fee{ config.fee() },
-		_httpService{ std::move(httpService) }
+		_httpService{ std::move(httpService) },
+		_rateLimiter{ std::make_unique<rate_limiter>(rate_limit{ 50, 50 }) },
+		_retryPolicy{ internal::create_retry_policy("/spot/quote/v1/depth") }
 	{}
 
 	std::string bybit_api::get_time_stamp() const
@@ -69,8 +86,7 @@ namespace mb
 
 	std::string bybit_api::compute_api_sign(std::string_view query) const
 	{
-		std::vector<unsigned char> signData{ hmac_sha256(query, _apiSecret) };
-		return hex_encode(signData);
+		return hex_encode(_signer.sign(query)).to_string();
 	}
 
 	exchange_status bybit_api::get_status() const
@@ -96,21 +112,27 @@ namespace mb
 
 	double bybit_api::get_price(const tradable_pair& tradablePair) const
 	{
-		std::string query = url_query_builder{}
-			.add_parameter("symbol", tradablePair.to_string())
-			.to_string();
+		return send_public_request<double>("/spot/quote/v1/ticker/price", bybit::read_price, create_price_query(tradablePair));
+	}
 
-		return send_public_request<double>("/spot/quote/v1/ticker/price", bybit::read_price, query);
+	std::unordered_map<tradable_pair, double> bybit_api::get_prices(const std::vector<tradable_pair>& pairs) const
+	{
+		// Without a symbol the ticker endpoint returns every pair in one response
+		std::unordered_map<std::string, double> namedPrices{ send_public_request<std::unordered_map<std::string, double>>("/spot/quote/v1/ticker/price", bybit::read_prices) };
+		return internal::create_pair_result_map(pairs, std::move(namedPrices));
 	}
 
 	order_book_state bybit_api::get_order_book(const tradable_pair& tradablePair, int depth) const
 	{
-		std::string query = url_query_builder{}
-			.add_parameter("symbol", tradablePair.to_string())
-			.add_parameter("limit", std::to_string(depth))
-			.to_string();
+		return send_public_request<order_book_state>("/spot/quote/v1/depth", bybit::read_order_book, create_order_book_query(tradablePair, depth));
+	}
 
-		return send_public_request<order_book_state>("/spot/quote/v1/depth", bybit::read_order_book, query);
+	std::unordered_map<tradable_pair, order_book_state> bybit_api::get_order_books(const std::vector<tradable_pair>& pairs, int depth) const
+	{
+		return internal::send_pair_requests<order_book_state>(pairs, [this, depth](const tradable_pair& pair)
+		{
+			return send_public_request_async<order_book_state>("/spot/quote/v1/depth", bybit::read_order_book, create_order_book_query(pair, depth));
+		});
 	}
 
 	double bybit_api::get_fee(const tradable_pair& tradablePair) const
@@ -158,12 +180,12 @@ namespace mb
 	}
 
 	template<>
-	std::unique_ptr<exchange> create_exchange_api<bybit_api>(bool testing)
+	std::unique_ptr<exchange> create_exchange_api<bybit_api>(bool testing, bool websocketCompression)
 	{
 		return std::make_unique<bybit_api>(
 			internal::load_or_create_config<bybit_config>(),
 			std::make_unique<http_service>(),
-			create_exchange_websocket_stream<internal::bybit_websocket_stream>(),
+			create_exchange_websocket_stream<internal::bybit_websocket_stream>(websocketCompression),
 			testing);
 	}
 }
\ No newline at end of file
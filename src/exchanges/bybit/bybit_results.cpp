@@ -140,6 +140,26 @@ namespace mb::bybit
 		});
 	}
 
+	result<std::unordered_map<std::string, double>> read_prices(std::string_view jsonResult)
+	{
+		return read_result<std::unordered_map<std::string, double>>(jsonResult, [](const json_element& resultElement)
+		{
+			std::unordered_map<std::string, double> prices;
+			prices.reserve(resultElement.size());
+
+			for (auto it = resultElement.begin(); it != resultElement.end(); ++it)
+			{
+				json_element priceElement{ it.value() };
+
+				prices.emplace(
+					priceElement.get<std::string>("symbol"),
+					std::stod(priceElement.get<std::string>("price")));
+			}
+
+			return prices;
+		});
+	}
+
 	result<order_book_state> read_order_book(std::string_view jsonResult)
 	{
 		return read_result<order_book_state>(jsonResult, [](const json_element& resultElement)
@@ -0,0 +1,167 @@
+#include "cached_exchange.h"
+#include "common/file/file.h"
+#include "logging/logger.h"
+
+namespace
+{
+	using namespace mb;
+
+	constexpr int SINGLE_VALUE_KEY = 0;
+
+	bool is_fresh(const std::filesystem::path& path, std::chrono::milliseconds timeToLive)
+	{
+		std::error_code error;
+		std::filesystem::file_time_type lastWrite{ std::filesystem::last_write_time(path, error) };
+
+		return !error && std::filesystem::file_time_type::clock::now() - lastWrite < timeToLive;
+	}
+}
+
+namespace mb
+{
+	cached_exchange::cached_exchange(
+		std::unique_ptr<exchange> exchangeApi,
+		std::filesystem::path warmCacheDirectory,
+		response_cache_ttls ttls)
+		:
+		exchange{ exchangeApi->id(), nullptr },
+		_exchange{ std::move(exchangeApi) },
+		_warmCacheDirectory{ std::move(warmCacheDirectory) },
+		_ttls{ ttls },
+		_status{ ttls.status },
+		_tradablePairs{ ttls.tradablePairs },
+		_fees{ ttls.fee },
+		_ohlcv{ ttls.ohlcv }
+	{}
+
+	std::filesystem::path cached_exchange::tradable_pairs_path() const
+	{
+		return _warmCacheDirectory / (std::string{ id() } + "_tradable_pairs.txt");
+	}
+
+	std::vector<tradable_pair> cached_exchange::load_tradable_pairs() const
+	{
+		if (_warmCacheDirectory.empty())
+		{
+			return _exchange->get_tradable_pairs();
+		}
+
+		std::filesystem::path path{ tradable_pairs_path() };
+
+		if (is_fresh(path, _ttls.tradablePairs))
+		{
+			std::vector<tradable_pair> pairs;
+			stream_file(path, [&pairs](std::string_view line) { pairs.emplace_back(parse_tradable_pair(line)); });
+
+			return pairs;
+		}
+
+		std::vector<tradable_pair> pairs{ _exchange->get_tradable_pairs() };
+
+		try
+		{
+			std::string content;
+
+			for (auto& pair : pairs)
+			{
+				content.append(pair.to_string('/'));
+				content.push_back('\n');
+			}
+
+			std::filesystem::create_directories(_warmCacheDirectory);
+			write_to_file(path, content);
+		}
+		catch (const std::exception& e)
+		{
+			logger::instance().warning("Could not write tradable pairs cache for {0}: {1}", id(), e.what());
+		}
+
+		return pairs;
+	}
+
+	std::shared_ptr<websocket_stream> cached_exchange::get_websocket_stream()
+	{
+		return _exchange->get_websocket_stream();
+	}
+
+	exchange_status cached_exchange::get_status() const
+	{
+		return _status.get(SINGLE_VALUE_KEY, [this]() { return _exchange->get_status(); });
+	}
+
+	std::vector<tradable_pair> cached_exchange::get_tradable_pairs() const
+	{
+		return _tradablePairs.get(SINGLE_VALUE_KEY, [this]() { return load_tradable_pairs(); });
+	}
+
+	std::vector<ohlcv_data> cached_exchange::get_ohlcv(const tradable_pair& tradablePair, ohlcv_interval interval, int count) const
+	{
+		std::string key{ tradablePair.to_string('/') + ":" + std::to_string(static_cast<int>(interval)) + ":" + std::to_string(count) };
+		return _ohlcv.get(key, [&]() { return _exchange->get_ohlcv(tradablePair, interval, count); });
+	}
+
+	double cached_exchange::get_price(const tradable_pair& tradablePair) const
+	{
+		return _exchange->get_price(tradablePair);
+	}
+
+	std::unordered_map<tradable_pair, double> cached_exchange::get_prices(const std::vector<tradable_pair>& pairs) const
+	{
+		return _exchange->get_prices(pairs);
+	}
+
+	order_book_state cached_exchange::get_order_book(const tradable_pair& tradablePair, int depth) const
+	{
+		return _exchange->get_order_book(tradablePair, depth);
+	}
+
+	std::unordered_map<tradable_pair, order_book_state> cached_exchange::get_order_books(const std::vector<tradable_pair>& pairs, int depth) const
+	{
+		return _exchange->get_order_books(pairs, depth);
+	}
+
+	double cached_exchange::get_fee(const tradable_pair& tradablePair) const
+	{
+		return _fees.get(tradablePair, [&]() { return _exchange->get_fee(tradablePair); });
+	}
+
+	std::unordered_map<std::string, double> cached_exchange::get_balances() const
+	{
+		return _exchange->get_balances();
+	}
+
+	std::vector<order_description> cached_exchange::get_open_orders() const
+	{
+		return _exchange->get_open_orders();
+	}
+
+	std::vector<order_description> cached_exchange::get_closed_orders() const
+	{
+		return _exchange->get_closed_orders();
+	}
+
+	std::string cached_exchange::add_order(const order_request& description)
+	{
+		return _exchange->add_order(description);
+	}
+
+	order_confirmation cached_exchange::add_order_confirm(const order_request& description)
+	{
+		return _exchange->add_order_confirm(description);
+	}
+
+	void cached_exchange::cancel_order(std::string_view orderId)
+	{
+		_exchange->cancel_order(orderId);
+	}
+
+	std::future<std::string> cached_exchange::add_order_async(const order_request& description)
+	{
+		return _exchange->add_order_async(description);
+	}
+
+	std::future<void> cached_exchange::cancel_order_async(std::string_view orderId)
+	{
+		return _exchange->cancel_order_async(orderId);
+	}
+}
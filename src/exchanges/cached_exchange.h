@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+
+#include "exchange.h"
+#include "common/types/ttl_cache.h"
+
+namespace mb
+{
+	struct response_cache_ttls
+	{
+		std::chrono::milliseconds status{ std::chrono::seconds{ 10 } };
+		std::chrono::milliseconds tradablePairs{ std::chrono::hours{ 1 } };
+		std::chrono::milliseconds fee{ std::chrono::hours{ 1 } };
+		std::chrono::milliseconds ohlcv{ std::chrono::seconds{ 5 } };
+	};
+
+	// Serves slow-changing endpoints from memory and passes everything else through. Tradable pairs
+	// are also written to the warm cache directory, if one is given, so restarts skip the download
+	class cached_exchange final : public exchange
+	{
+	private:
+		std::unique_ptr<exchange> _exchange;
+		std::filesystem::path _warmCacheDirectory;
+		response_cache_ttls _ttls;
+
+		mutable ttl_cache<int, exchange_status> _status;
+		mutable ttl_cache<int, std::vector<tradable_pair>> _tradablePairs;
+		mutable ttl_cache<tradable_pair, double> _fees;
+		mutable ttl_cache<std::string, std::vector<ohlcv_data>> _ohlcv;
+
+		std::filesystem::path tradable_pairs_path() const;
+		std::vector<tradable_pair> load_tradable_pairs() const;
+
+	public:
+		cached_exchange(
+			std::unique_ptr<exchange> exchangeApi,
+			std::filesystem::path warmCacheDirectory = {},
+			response_cache_ttls ttls = {});
+
+		std::shared_ptr<websocket_stream> get_websocket_stream() override;
+
+		exchange_status get_status() const override;
+		std::vector<tradable_pair> get_tradable_pairs() const override;
+		std::vector<ohlcv_data> get_ohlcv(const tradable_pair& tradablePair, ohlcv_interval interval, int count) const override;
+		double get_price(const tradable_pair& tradablePair) const override;
+		std::unordered_map<tradable_pair, double> get_prices(const std::vector<tradable_pair>& pairs) const override;
+		order_book_state get_order_book(const tradable_pair& tradablePair, int depth) const override;
+		std::unordered_map<tradable_pair, order_book_state> get_order_books(const std::vector<tradable_pair>& pairs, int depth) const override;
+		double get_fee(const tradable_pair& tradablePair) const override;
+		std::unordered_map<std::string, double> get_balances() const override;
+		std::vector<order_description> get_open_orders() const override;
+		std::vector<order_description> get_closed_orders() const override;
+		std::string add_order(const order_request& description) override;
+		order_confirmation add_order_confirm(const order_request& description) override;
+		void cancel_order(std::string_view orderId) override;
+		std::future<std::string> add_order_async(const order_request& description) override;
+		std::future<void> cancel_order_async(std::string_view orderId) override;
+	};
+}
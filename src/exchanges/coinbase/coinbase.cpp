@@ -43,6 +43,22 @@ namespace
 	{
 		return orderType == order_type::STOP_LOSS || orderType == order_type::TAKE_PROFIT;
 	}
+
+	std::string create_product_path(const tradable_pair& tradablePair, char pairSeparator, std::string_view resource)
+	{
+		return "/products/" + tradablePair.to_string(pairSeparator) + "/" + std::string{ resource };
+	}
+
+	std::string create_order_book_query(int depth)
+	{
+		int level = depth == 1 
+			? 1 
+			: 2;
+
+		return url_query_builder{}
+			.add_parameter("level", std::to_string(level))
+			.to_string();
+	}
 }
 
 namespace mb
@@ -57,9 +73,12 @@ namespace mb
 		_baseUrl{ select_base_url(enableTesting) },
 		_userAgentId{ get_timestamp() },
 		_apiKey{ config.api_key() },
-		_decodedApiSecret{ b64_decode(config.api_secret()) },
+		_signer{ create_hmac_sha256_signer(b64_decode(config.api_secret())) },
 		_apiPassphrase{ config.api_passphrase() },
-		_httpService{ std::move(httpService) }
+		_httpService{ std::move(httpService) },
+		_publicRateLimiter{ std::make_unique<rate_limiter>(rate_limit{ 15, 10 }) },
+		_privateRateLimiter{ std::make_unique<rate_limiter>(rate_limit{ 30, 15 }) },
+		_retryPolicy{ internal::create_retry_policy("/book") }
 	{}
 
 	std::string coinbase_api::get_timestamp() const
@@ -69,16 +88,8 @@ namespace mb
 
 	std::string coinbase_api::compute_access_sign(std::string_view timestamp, http_verb httpVerb, std::string_view path, std::string_view query, std::string_view body) const
 	{
-		std::string message;
-		message.append(timestamp);
-		message.append(to_string(httpVerb));
-		message.append(path);
-		append_query(message, query);
-		message.append(body);
-		
-		auto hmac = hmac_sha256(message, _decodedApiSecret);
-		auto encoded = b64_encode(hmac);
-		return encoded;
+		std::string_view querySeparator{ query.empty() ? "" : "?" };
+		return b64_encode(_signer.sign(timestamp, to_string(httpVerb), path, querySeparator, query, body)).to_string();
 	}
 
 	exchange_status coinbase_api::get_status() const
@@ -107,27 +118,34 @@ namespace mb
 
 	double coinbase_api::get_price(const tradable_pair& tradablePair) const
 	{
-		std::string path = "/products/" + tradablePair.to_string(_pairSeparator) + "/ticker";
+		return send_public_request<double>(create_product_path(tradablePair, _pairSeparator, "ticker"), coinbase::read_price);
+	}
 
-		return send_public_request<double>(path, coinbase::read_price);
+	std::unordered_map<tradable_pair, double> coinbase_api::get_prices(const std::vector<tradable_pair>& pairs) const
+	{
+		return internal::send_pair_requests<double>(pairs, [this](const tradable_pair& pair)
+		{
+			return send_public_request_async<double>(create_product_path(pair, _pairSeparator, "ticker"), coinbase::read_price);
+		});
 	}
 
 	order_book_state coinbase_api::get_order_book(const tradable_pair& tradablePair, int depth) const
 	{
-		std::string path = "/products/" + tradablePair.to_string(_pairSeparator) + "/book";
-
-		int level = depth == 1 
-			? 1 
-			: 2;
-
-		std::string query{ url_query_builder{}
-			.add_parameter("level", std::to_string(level))
-			.to_string() };
-
 		return send_public_request<order_book_state>(
-			path, 
+			create_product_path(tradablePair, _pairSeparator, "book"), 
 			[depth](std::string_view jsonResult) { return coinbase::read_order_book(jsonResult, depth); },
-			query);
+			create_order_book_query(depth));
+	}
+
+	std::unordered_map<tradable_pair, order_book_state> coinbase_api::get_order_books(const std::vector<tradable_pair>& pairs, int depth) const
+	{
+		return internal::send_pair_requests<order_book_state>(pairs, [this, depth](const tradable_pair& pair)
+		{
+			return send_public_request_async<order_book_state>(
+				create_product_path(pair, _pairSeparator, "book"),
+				[depth](std::string_view jsonResult) { return coinbase::read_order_book(jsonResult, depth); },
+				create_order_book_query(depth));
+		});
 	}
 
 	double coinbase_api::get_fee(const tradable_pair& tradablePair) const
@@ -184,7 +202,7 @@ namespace mb
 	}
 
 	template<>
-	std::unique_ptr<websocket_stream> create_exchange_websocket_stream<internal::coinbase_websocket_stream>()
+	std::unique_ptr<websocket_stream> create_exchange_websocket_stream<internal::coinbase_websocket_stream>(bool compression)
 	{
 		std::unique_ptr<coinbase_api> marketApi{ std::make_unique<coinbase_api>(
 			coinbase_config{},
@@ -193,17 +211,17 @@ namespace mb
 			false) };
 
 		return std::make_unique<internal::coinbase_websocket_stream>(
-			std::make_unique<websocket_connection_factory>(),
+			std::make_unique<websocket_connection_factory>(compression),
 			std::move(marketApi));
 	}
 
 	template<>
-	std::unique_ptr<exchange> create_exchange_api<coinbase_api>(bool testing)
+	std::unique_ptr<exchange> create_exchange_api<coinbase_api>(bool testing, bool websocketCompression)
 	{
 		return std::make_unique<coinbase_api>(
 			internal::load_or_create_config<coinbase_config>(),
 			std::make_unique<http_service>(),
-			create_exchange_websocket_stream<internal::coinbase_websocket_stream>(),
+			create_exchange_websocket_stream<internal::coinbase_websocket_stream>(websocketCompression),
 			testing);
 	}
 }
\ No newline at end of file
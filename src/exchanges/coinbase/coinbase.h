@@ -5,6 +5,7 @@
 #include "exchanges/exchange.h"
 #include "exchanges/exchange_ids.h"
 #include "exchanges/exchange_common.h"
+#include "common/security/hmac_signer.h"
 #include "networking/http/http_service.h"
 #include "networking/url.h"
 
@@ -18,32 +19,52 @@ namespace mb
 
 		std::string _userAgentId;
 		std::string _apiKey;
-		std::vector<unsigned char> _decodedApiSecret;
+		hmac_signer _signer;
 		std::string _apiPassphrase;
 		std::unique_ptr<http_service> _httpService;
+		std::unique_ptr<rate_limiter> _publicRateLimiter;
+		std::unique_ptr<rate_limiter> _privateRateLimiter;
+		std::unique_ptr<retry_policy> _retryPolicy;
 
 		std::string get_timestamp() const;
 		std::string compute_access_sign(std::string_view timestamp, http_verb httpVerb, std::string_view path, std::string_view query, std::string_view body) const;
 
-		template<typename Value, typename ResponseReader>
-		Value send_request(http_request& request, const ResponseReader& reader) const
+		void add_common_headers(http_request& request) const
 		{
 			request.add_header(common_http_headers::USER_AGENT, _userAgentId);
 			request.add_header(common_http_headers::ACCEPT, common_http_headers::APPLICATION_JSON);
-			
-			return internal::send_http_request<Value>(*_httpService, request, reader);
+		}
+
+		template<typename Value, typename ResponseReader>
+		Value send_request(http_request& request, const ResponseReader& reader, rate_limiter& rateLimiter) const
+		{
+			add_common_headers(request);
+			return internal::send_acquired_http_request<Value>(*_httpService, request, reader, rateLimiter);
 		}
 
 		template<typename Value, typename ResponseReader>
 		Value send_public_request(std::string_view path, const ResponseReader& reader, std::string_view query = "") const
 		{
 			http_request request{ http_verb::GET, build_url(_baseUrl, path, query) };
-			return send_request<Value>(request, reader);
+			add_common_headers(request);
+
+			return internal::send_http_request<Value>(*_httpService, request, reader, *_publicRateLimiter, *_retryPolicy);
+		}
+
+		template<typename Value, typename ResponseReader>
+		std::future<Value> send_public_request_async(std::string_view path, ResponseReader reader, std::string_view query = "") const
+		{
+			http_request request{ http_verb::GET, build_url(_baseUrl, path, query) };
+			add_common_headers(request);
+
+			return internal::send_http_request_async<Value>(*_httpService, request, reader, *_publicRateLimiter, *_retryPolicy);
 		}
 
 		template<typename Value, typename ResponseReader>
 		Value send_private_request(http_verb httpVerb, std::string path, const ResponseReader& reader, std::string_view query = "", std::string_view content = "") const
 		{
+			_privateRateLimiter->acquire(1, internal::to_request_priority(httpVerb));
+
 			http_request request{ httpVerb, build_url(_baseUrl, path, query) };
 
 			if (!content.empty())
@@ -59,7 +80,7 @@ namespace mb
 			request.add_header("CB-ACCESS-TIMESTAMP", timestamp);
 			request.add_header("CB-ACCESS-PASSPHRASE", _apiPassphrase);
 
-			return send_request<Value>(request, reader);
+			return send_request<Value>(request, reader, *_privateRateLimiter);
 		}
 
 	public:
@@ -73,7 +94,9 @@ namespace mb
 		std::vector<tradable_pair> get_tradable_pairs() const override;
 		std::vector<ohlcv_data> get_ohlcv(const tradable_pair& tradablePair, ohlcv_interval interval, int count) const override;
 		double get_price(const tradable_pair& tradablePair) const override;
+		std::unordered_map<tradable_pair, double> get_prices(const std::vector<tradable_pair>& pairs) const override;
 		order_book_state get_order_book(const tradable_pair& tradablePair, int depth) const override;
+		std::unordered_map<tradable_pair, order_book_state> get_order_books(const std::vector<tradable_pair>& pairs, int depth) const override;
 		double get_fee(const tradable_pair& tradablePair) const override;
 		std::unordered_map<std::string,double> get_balances() const override;
 		std::vector<order_description> get_open_orders() const override;
@@ -83,5 +106,5 @@ namespace mb
 	};
 
 	template<>
-	std::unique_ptr<exchange> create_exchange_api<coinbase_api>(bool testing);
+	std::unique_ptr<exchange> create_exchange_api<coinbase_api>(bool testing, bool websocketCompression);
 }
\ No newline at end of file
@@ -50,6 +50,21 @@ namespace
 
 		return volume;
 	}
+
+	std::string create_price_query(const tradable_pair& tradablePair, char pairSeparator)
+	{
+		return url_query_builder{}
+			.add_parameter("symbol", tradablePair.to_string(pairSeparator))
+			.to_string();
+	}
+
+	std::string create_order_book_query(const tradable_pair& tradablePair, int depth)
+	{
+		return url_query_builder{}
+			.add_parameter("symbol", tradablePair.to_string('_'))
+			.add_parameter("limit", std::to_string(depth))
+			.to_string();
+	}
 }
 
 namespace mb
@@ -62,14 +77,15 @@ namespace mb
 		: 
 		exchange{ exchange_ids::DIGIFINEX, std::move(websocketStream) },
 		_apiKey{ config.api_key() },
-		_apiSecret{ config.api_secret() },
-		_httpService{ std::move(httpService) }
+		_signer{ create_hmac_sha256_signer(config.api_secret()) },
+		_httpService{ std::move(httpService) },
+		_rateLimiter{ std::make_unique<rate_limiter>(rate_limit{ 10, 10 }) },
+		_retryPolicy{ internal::create_retry_policy("/order_book") }
 	{}
 
 	std::string digifinex_api::compute_api_sign(std::string_view query) const
 	{
-		std::vector<unsigned char> signData{ hmac_sha256(query, _apiSecret) };
-		return hex_encode(signData);
+		return hex_encode(_signer.sign(query)).to_string();
 	}
 
 	exchange_status digifinex_api::get_status() const
@@ -97,21 +113,27 @@ namespace mb
 
 	double digifinex_api::get_price(const tradable_pair& tradablePair) const
 	{
-		std::string query = url_query_builder{}
-			.add_parameter("symbol", tradablePair.to_string(_pairSeparator))
-			.to_string();
+		return send_public_request<double>("/ticker", digifinex::read_price, create_price_query(tradablePair, _pairSeparator));
+	}
 
-		return send_public_request<double>("/ticker", digifinex::read_price, query);
+	std::unordered_map<tradable_pair, double> digifinex_api::get_prices(const std::vector<tradable_pair>& pairs) const
+	{
+		// Without a symbol the ticker endpoint returns every pair in one response
+		std::unordered_map<std::string, double> namedPrices{ send_public_request<std::unordered_map<std::string, double>>("/ticker", digifinex::read_prices) };
+		return internal::create_pair_result_map(pairs, std::move(namedPrices), [](const tradable_pair& pair) { return pair.to_string(_pairSeparator); });
 	}
 
 	order_book_state digifinex_api::get_order_book(const tradable_pair& tradablePair, int depth) const
 	{
-		std::string query = url_query_builder{}
-			.add_parameter("symbol", tradablePair.to_string('_'))
-			.add_parameter("limit", std::to_string(depth))
-			.to_string();
+		return send_public_request<order_book_state>("order_book", digifinex::read_order_book, create_order_book_query(tradablePair, depth));
+	}
 
-		return send_public_request<order_book_state>("order_book", digifinex::read_order_book, query);
+	std::unordered_map<tradable_pair, order_book_state> digifinex_api::get_order_books(const std::vector<tradable_pair>& pairs, int depth) const
+	{
+		return internal::send_pair_requests<order_book_state>(pairs, [this, depth](const tradable_pair& pair)
+		{
+			return send_public_request_async<order_book_state>("order_book", digifinex::read_order_book, create_order_book_query(pair, depth));
+		});
 	}
 
 	double digifinex_api::get_fee(const tradable_pair& tradablePair) const
@@ -158,7 +180,7 @@ namespace mb
 	}
 
 	template<>
-	std::unique_ptr<websocket_stream> create_exchange_websocket_stream<internal::digifinex_websocket_stream>()
+	std::unique_ptr<websocket_stream> create_exchange_websocket_stream<internal::digifinex_websocket_stream>(bool compression)
 	{
 		std::unique_ptr<digifinex_api> marketApi{ std::make_unique<digifinex_api>(
 			digifinex_config{},
@@ -167,17 +189,17 @@ namespace mb
 			false) };
 
 		return std::make_unique<internal::digifinex_websocket_stream>(
-			std::make_unique<websocket_connection_factory>(),
+			std::make_unique<websocket_connection_factory>(compression),
 			std::move(marketApi));
 	}
 
 	template<>
-	std::unique_ptr<exchange> create_exchange_api<digifinex_api>(bool testing)
+	std::unique_ptr<exchange> create_exchange_api<digifinex_api>(bool testing, bool websocketCompression)
 	{
 		return std::make_unique<digifinex_api>(
 			internal::load_or_create_config<digifinex_config>(),
 			std::make_unique<http_service>(),
-			create_exchange_websocket_stream<internal::digifinex_websocket_stream>(),
+			create_exchange_websocket_stream<internal::digifinex_websocket_stream>(websocketCompression),
 			testing);
 	}
 }
\ No newline at end of file
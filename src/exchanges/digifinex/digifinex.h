@@ -6,6 +6,7 @@
 #include "exchanges/exchange.h"
 #include "exchanges/exchange_ids.h"
 #include "exchanges/exchange_common.h"
+#include "common/security/hmac_signer.h"
 #include "networking/http/http_service.h"
 #include "networking/url.h"
 #include "common/utils/timeutils.h"
@@ -20,8 +21,10 @@ namespace mb
 		static constexpr std::string_view _baseUrl = "https://openapi.digifinex.com/v3";
 
 		std::string _apiKey;
-		std::string _apiSecret;
+		hmac_signer _signer;
 		std::unique_ptr<http_service> _httpService;
+		std::unique_ptr<rate_limiter> _rateLimiter;
+		std::unique_ptr<retry_policy> _retryPolicy;
 
 		std::string compute_api_sign(std::string_view query) const;
 
@@ -29,12 +32,21 @@ namespace mb
 		Value send_public_request(std::string_view path, const ResponseReader& reader, std::string_view query = "") const
 		{
 			http_request request{ http_verb::GET, build_url(_baseUrl, path, query) };
-			return internal::send_http_request<Value>(*_httpService, request, reader);
+			return internal::send_http_request<Value>(*_httpService, request, reader, *_rateLimiter, *_retryPolicy);
+		}
+
+		template<typename Value, typename ResponseReader>
+		std::future<Value> send_public_request_async(std::string_view path, ResponseReader reader, std::string_view query = "") const
+		{
+			http_request request{ http_verb::GET, build_url(_baseUrl, path, query) };
+			return internal::send_http_request_async<Value>(*_httpService, request, reader, *_rateLimiter, *_retryPolicy);
 		}
 
 		template<typename Value, typename ResponseReader>
 		Value send_private_request(http_verb verb, std::string_view path, const ResponseReader& reader, std::string_view query = "") const
 		{
+			_rateLimiter->acquire(1, internal::to_request_priority(verb));
+
 			http_request request{ verb, build_url(_baseUrl, path, query) };
 
 			std::string timestamp{ std::to_string(time_since_epoch<std::chrono::seconds>()) };
@@ -43,7 +55,7 @@ namespace mb
 			request.add_header("ACCESS-TIMESTAMP", timestamp);
 			request.add_header("ACCESS-SIGN", compute_api_sign(query));
 
-			return internal::send_http_request<Value>(*_httpService, request, reader);
+			return internal::send_acquired_http_request<Value>(*_httpService, request, reader, *_rateLimiter);
 		}
 
 	public:
@@ -57,7 +69,9 @@ namespace mb
 		std::vector<tradable_pair> get_tradable_pairs() const override;
 		std::vector<ohlcv_data> get_ohlcv(const tradable_pair& tradablePair, ohlcv_interval interval, int count) const override;
 		double get_price(const tradable_pair& tradablePair) const override;
+		std::unordered_map<tradable_pair, double> get_prices(const std::vector<tradable_pair>& pairs) const override;
 		order_book_state get_order_book(const tradable_pair& tradablePair, int depth) const override;
+		std::unordered_map<tradable_pair, order_book_state> get_order_books(const std::vector<tradable_pair>& pairs, int depth) const override;
 		double get_fee(const tradable_pair& tradablePair) const override;
 		std::unordered_map<std::string,double> get_balances() const override;
 		std::vector<order_description> get_open_orders() const override;
@@ -67,5 +81,5 @@ namespace mb
 	};
 
 	template<>
-	std::unique_ptr<exchange> create_exchange_api<digifinex_api>(bool testing);
+	std::unique_ptr<exchange> create_exchange_api<digifinex_api>(bool testing, bool websocketCompression);
 }
\ No newline at end of file
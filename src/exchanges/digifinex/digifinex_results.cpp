@@ -183,6 +183,29 @@ namespace mb::digifinex
 		});
 	}
 
+	result<std::unordered_map<std::string, double>> read_prices(std::string_view jsonResult)
+	{
+		return read_result<std::unordered_map<std::string, double>>(jsonResult, [](const json_document& json)
+		{
+			json_element tickersElement{ json.element("ticker") };
+
+			std::unordered_map<std::string, double> prices;
+			prices.reserve(tickersElement.size());
+
+			for (auto it = tickersElement.begin(); it != tickersElement.end(); ++it)
+			{
+				json_element tickerElement{ it.value() };
+
+				std::string symbol{ tickerElement.get<std::string>("symbol") };
+				to_upper(symbol);
+
+				prices.emplace(std::move(symbol), tickerElement.get<double>("last"));
+			}
+
+			return prices;
+		});
+	}
+
 	result<order_book_state> read_order_book(std::string_view jsonResult)
 	{
 		return read_result<order_book_state>(jsonResult, [](const json_document& json)
@@ -18,6 +18,7 @@ namespace mb::digifinex
 	result<std::vector<tradable_pair>> read_tradable_pairs(std::string_view jsonResult);
 	result<std::vector<ohlcv_data>> read_ohlcv_data(std::string_view jsonResult, int count);
 	result<double> read_price(std::string_view jsonResult);
+	result<std::unordered_map<std::string, double>> read_prices(std::string_view jsonResult);
 	result<order_book_state> read_order_book(std::string_view jsonResult);
 	result<std::unordered_map<std::string,double>> read_balances(std::string_view jsonResult);
 	result<std::vector<order_description>> read_open_orders(std::string_view jsonResult);
@@ -50,7 +50,7 @@ namespace mb::internal
 		_ohlcvSubscriptionService{ ohlcv_subscription_service
 			{
 				std::move(marketApi),
-				[this](std::string pairName, ohlcv_interval interval, ohlcv_data ohlcv) { update_ohlcv(std::move(pairName), interval, std::move(ohlcv)); },
+				[this](const std::string& pairName, ohlcv_interval interval, const ohlcv_data& ohlcv) { update_ohlcv(pairName, interval, ohlcv); },
 				PAIR_SEPARATOR
 			} }
 	{}
@@ -52,4 +52,27 @@ namespace mb
 	{
 		throw not_implemented_exception{ "exchange::add_order_confirm" };
 	}
+
+	std::future<std::string> trade_api::add_order_async(const order_request& description)
+	{
+		return std::async(std::launch::async, [this, description]() { return add_order(description); });
+	}
+
+	std::future<void> trade_api::cancel_order_async(std::string_view orderId)
+	{
+		return std::async(std::launch::async, [this, orderId = std::string{ orderId }]() { cancel_order(orderId); });
+	}
+
+	std::vector<std::future<std::string>> trade_api::add_orders_async(const std::vector<order_request>& descriptions)
+	{
+		std::vector<std::future<std::string>> orderIds;
+		orderIds.reserve(descriptions.size());
+
+		for (auto& description : descriptions)
+		{
+			orderIds.emplace_back(add_order_async(description));
+		}
+
+		return orderIds;
+	}
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <future>
 
 #include "exchange_status.h"
 #include "websockets/websocket_stream.h"
@@ -43,6 +44,13 @@ namespace mb
 		virtual void cancel_order(std::string_view orderId) = 0;
 
 		virtual order_confirmation add_order_confirm(const order_request& description);
+
+		// Default implementations run the blocking call on its own thread, so several orders can be in flight at once
+		virtual std::future<std::string> add_order_async(const order_request& description);
+		virtual std::future<void> cancel_order_async(std::string_view orderId);
+
+		// Submits every order before waiting on any of them, so multi-leg trades are not delayed by each leg's round trip
+		std::vector<std::future<std::string>> add_orders_async(const std::vector<order_request>& descriptions);
 	};
 
 	class exchange : public market_api, public trade_api
@@ -58,11 +66,11 @@ namespace mb
 		virtual ~exchange() = default;
 
 		constexpr std::string_view id() const noexcept { return _id; }
-		std::shared_ptr<websocket_stream> get_websocket_stream();
+		virtual std::shared_ptr<websocket_stream> get_websocket_stream();
 	};	
 
 	template<typename T>
-	std::unique_ptr<exchange> create_exchange_api(bool testing = false)
+	std::unique_ptr<exchange> create_exchange_api(bool testing = false, bool websocketCompression = false)
 	{
 		static_assert(sizeof(T) == 0, "No specialization of create_exchange_api found");
 	}
@@ -1,21 +1,23 @@
 #pragma once
 
+#include <future>
+
 #include "networking/http/http_service.h"
+#include "networking/http/rate_limiter.h"
+#include "networking/http/retry_policy.h"
 #include "common/types/result.h"
 
 namespace mb::internal
 {
 	template<typename Value, typename ResponseReader>
-	Value send_http_request(const http_service& httpService, http_request& request, const ResponseReader& reader)
+	Value read_http_response(const http_response& response, const ResponseReader& reader)
 	{
-		http_response response{ httpService.send(request) };
-
 		if (response.response_code() != HttpResponseCodes::OK)
 		{
 			throw mb_exception{ response.message() };
 		}
 
-		result<Value> result{ reader(response.message()) };
+		result<Value> result{ reader(response.body()) };
 
 		if (result.is_success())
 		{
@@ -25,22 +27,119 @@ namespace mb::internal
 		throw mb_exception{ result.error() };
 	}
 
-	template<typename T>
-	std::unordered_map<tradable_pair, T> create_pair_result_map(const std::vector<tradable_pair>& pairs, std::unordered_map<std::string, T> namedResults)
+	// Anything other than a read places or cancels an order
+	constexpr request_priority to_request_priority(http_verb verb)
+	{
+		return verb == http_verb::GET
+			? request_priority::NORMAL
+			: request_priority::ORDER;
+	}
+
+	// Sends a request whose weight has already been acquired from the limiter. Signed requests acquire before taking
+	// their nonce or timestamp, so a wait in the limiter cannot send them out of nonce order or with a stale signature
+	template<typename Value, typename ResponseReader>
+	Value send_acquired_http_request(const http_service& httpService, http_request& request, const ResponseReader& reader, rate_limiter& rateLimiter)
+	{
+		http_response response{ httpService.send(request) };
+		rateLimiter.record_response(response);
+
+		return read_http_response<Value>(response, reader);
+	}
+
+	template<typename Value, typename ResponseReader>
+	Value send_http_request(const http_service& httpService, http_request& request, const ResponseReader& reader, rate_limiter& rateLimiter, double weight = 1, request_priority priority = request_priority::NORMAL)
 	{
-		std::unordered_map<std::string, tradable_pair> pairLookup{ to_unordered_map<std::string, tradable_pair>(
-			pairs,
-			[](const tradable_pair& pair) { return pair.to_string(); },
-			[](const tradable_pair& pair) { return pair; }) };
+		rateLimiter.acquire(weight, priority);
+		return send_acquired_http_request<Value>(httpService, request, reader, rateLimiter);
+	}
 
-		std::unordered_map<tradable_pair, double> result;
-		result.reserve(namedResults.size());
+	// Public reads are idempotent, so transient failures are retried under the exchange's retry policy
+	template<typename Value, typename ResponseReader>
+	Value send_http_request(const http_service& httpService, const http_request& request, const ResponseReader& reader, rate_limiter& rateLimiter, retry_policy& retryPolicy, double weight = 1)
+	{
+		return read_http_response<Value>(retryPolicy.send(httpService, request, rateLimiter, weight), reader);
+	}
+
+	// The response is read on the thread that calls get() on the returned future
+	template<typename Value, typename ResponseReader>
+	std::future<Value> send_http_request_async(const http_service& httpService, const http_request& request, ResponseReader reader, rate_limiter& rateLimiter, double weight = 1)
+	{
+		rateLimiter.acquire(weight);
 
-		for (auto& [name, value] : namedResults)
+		return std::async(std::launch::deferred, [response = httpService.send_async(request), reader, &rateLimiter]() mutable
 		{
-			result.emplace(pairLookup.at(name), std::move(value));
+			http_response result{ response.get() };
+			rateLimiter.record_response(result);
+
+			return read_http_response<Value>(result, reader);
+		});
+	}
+
+	template<typename Value, typename ResponseReader>
+	std::future<Value> send_http_request_async(const http_service& httpService, const http_request& request, ResponseReader reader, rate_limiter& rateLimiter, retry_policy& retryPolicy, double weight = 1)
+	{
+		rateLimiter.acquire(weight);
+
+		return std::async(std::launch::deferred, [response = httpService.send_async(request), &httpService, request, reader, &rateLimiter, &retryPolicy, weight]() mutable
+		{
+			return read_http_response<Value>(retryPolicy.complete(std::move(response), httpService, request, rateLimiter, weight), reader);
+		});
+	}
+
+	// Order books are stale within a couple of seconds, so their requests stop retrying sooner than other reads
+	inline std::unique_ptr<retry_policy> create_retry_policy(std::string orderBookEndpoint)
+	{
+		auto retryPolicy = std::make_unique<retry_policy>();
+		retryPolicy->set_deadline(std::move(orderBookEndpoint), std::chrono::seconds{ 2 });
+
+		return retryPolicy;
+	}
+
+	template<typename Value, typename SendAsync>
+	std::unordered_map<tradable_pair, Value> send_pair_requests(const std::vector<tradable_pair>& pairs, const SendAsync& sendAsync)
+	{
+		std::vector<std::future<Value>> responses;
+		responses.reserve(pairs.size());
+
+		for (auto& pair : pairs)
+		{
+			responses.emplace_back(sendAsync(pair));
+		}
+
+		std::unordered_map<tradable_pair, Value> results;
+		results.reserve(pairs.size());
+
+		for (int i = 0; i < pairs.size(); ++i)
+		{
+			results.emplace(pairs[i], responses[i].get());
+		}
+
+		return results;
+	}
+
+	// Results for pairs that were not asked for are dropped, so whole-market responses can be filtered
+	template<typename T, typename NameSelector>
+	std::unordered_map<tradable_pair, T> create_pair_result_map(const std::vector<tradable_pair>& pairs, std::unordered_map<std::string, T> namedResults, const NameSelector& nameSelector)
+	{
+		std::unordered_map<tradable_pair, T> result;
+		result.reserve(pairs.size());
+
+		for (auto& pair : pairs)
+		{
+			auto it = namedResults.find(nameSelector(pair));
+
+			if (it != namedResults.end())
+			{
+				result.emplace(pair, std::move(it->second));
+			}
 		}
 
 		return result;
 	}
+
+	template<typename T>
+	std::unordered_map<tradable_pair, T> create_pair_result_map(const std::vector<tradable_pair>& pairs, std::unordered_map<std::string, T> namedResults)
+	{
+		return create_pair_result_map(pairs, std::move(namedResults), [](const tradable_pair& pair) { return pair.to_string(); });
+	}
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <chrono>
+#include <array>
 
 #include "kraken.h"
 #include "kraken_results.h"
@@ -9,6 +10,7 @@
 #include "common/utils/stringutils.h"
 #include "common/utils/containerutils.h"
 #include "common/utils/timeutils.h"
+#include "common/types/monotonic_nonce.h"
 #include "common/security/hash.h"
 #include "common/security/encoding.h"
 
@@ -51,6 +53,14 @@ namespace
 		pairList.pop_back();
 		return pairList;
 	}
+
+	std::string create_order_book_query(const tradable_pair& tradablePair, int depth)
+	{
+		return url_query_builder{}
+			.add_parameter("pair", tradablePair.to_string())
+			.add_parameter("count", std::to_string(depth))
+			.to_string();
+	}
 }
 
 namespace mb
@@ -63,23 +73,31 @@ namespace mb
 		:
 		exchange{ exchange_ids::KRAKEN, std::move(websocketStream) },
 		_publicKey{ config.public_key() },
-		_decodedPrivateKey{ b64_decode(config.private_key()) },
-		_httpService{ std::move(httpService) }
+		_signer{ create_hmac_sha512_signer(b64_decode(config.private_key())) },
+		_httpService{ std::move(httpService) },
+		_publicRateLimiter{ std::make_unique<rate_limiter>(rate_limit{ 5, 1, "", "Rate limit exceeded" }) },
+		// Starter tier counter: decays by 0.33 per second up to a maximum of 15
+		_privateRateLimiter{ std::make_unique<rate_limiter>(rate_limit{ 15, 0.33, "", "Rate limit exceeded" }) },
+		_retryPolicy{ internal::create_retry_policy("/Depth") }
 	{}
 
 	std::string kraken_api::get_nonce() const
 	{
-		return std::to_string(time_since_epoch<std::chrono::milliseconds>());
+		return std::to_string(monotonic_nonce::instance().next());
 	}
 
 	std::string kraken_api::compute_api_sign(std::string_view uriPath, std::string_view urlPostData, std::string_view nonce) const
 	{
-		std::vector<unsigned char> nonce_postData = sha256(std::string{ nonce }.append(urlPostData));
+		std::array<unsigned char, SHA256_DIGEST_LENGTH> noncePostData;
 
-		std::vector<unsigned char> message{ uriPath.begin(), uriPath.end() };
-		message.insert(message.end(), nonce_postData.begin(), nonce_postData.end());
+		SHA256_CTX context;
+		SHA256_Init(&context);
+		SHA256_Update(&context, nonce.data(), nonce.size());
+		SHA256_Update(&context, urlPostData.data(), urlPostData.size());
+		SHA256_Final(noncePostData.data(), &context);
 
-		return b64_encode(hmac_sha512(message, _decodedPrivateKey));
+		std::string_view noncePostDataView{ reinterpret_cast<const char*>(noncePostData.data()), noncePostData.size() };
+		return b64_encode(_signer.sign(uriPath, noncePostDataView)).to_string();
 	}
 
 	std::string kraken_api::build_kraken_path(std::string access, std::string method) const
@@ -87,6 +105,22 @@ namespace mb
 		return "/0/" + std::move(access) + "/" + std::move(method);
 	}
 
+	std::pair<int, request_priority> kraken_api::private_request_cost(std::string_view method)
+	{
+		// Orders are limited by the matching engine rather than the API counter
+		if (method == "AddOrder" || method == "CancelOrder")
+		{
+			return { 0, request_priority::ORDER };
+		}
+
+		if (method == "ClosedOrders" || method == "TradesHistory" || method == "Ledgers" || method == "QueryLedgers")
+		{
+			return { 2, request_priority::NORMAL };
+		}
+
+		return { 1, request_priority::NORMAL };
+	}
+
 	exchange_status kraken_api::get_status() const
 	{
 		return send_public_request<exchange_status>("SystemStatus", kraken::read_system_status);
@@ -131,12 +165,15 @@ namespace mb
 
 	order_book_state kraken_api::get_order_book(const tradable_pair& tradablePair, int depth) const
 	{
-		std::string query = url_query_builder{}
-			.add_parameter("pair", tradablePair.to_string())
-			.add_parameter("count", std::to_string(depth))
-			.to_string();
+		return send_public_request<order_book_state>("Depth", kraken::read_order_book, create_order_book_query(tradablePair, depth));
+	}
 
-		return send_public_request<order_book_state>("Depth", kraken::read_order_book, query);
+	std::unordered_map<tradable_pair, order_book_state> kraken_api::get_order_books(const std::vector<tradable_pair>& pairs, int depth) const
+	{
+		return internal::send_pair_requests<order_book_state>(pairs, [this, depth](const tradable_pair& pair)
+		{
+			return send_public_request_async<order_book_state>("Depth", kraken::read_order_book, create_order_book_query(pair, depth));
+		});
 	}
 
 	double kraken_api::get_fee(const tradable_pair& tradablePair) const
@@ -186,12 +223,12 @@ namespace mb
 	}
 
 	template<>
-	std::unique_ptr<exchange> create_exchange_api<kraken_api>(bool testing)
+	std::unique_ptr<exchange> create_exchange_api<kraken_api>(bool testing, bool websocketCompression)
 	{
 		return std::make_unique<kraken_api>(
 			internal::load_or_create_config<kraken_config>(),
 			std::make_unique<http_service>(),
-			create_exchange_websocket_stream<internal::kraken_websocket_stream>(),
+			create_exchange_websocket_stream<internal::kraken_websocket_stream>(websocketCompression),
 			testing);
 	}
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "exchanges/exchange.h"
 #include "exchanges/exchange_ids.h"
 #include "exchanges/exchange_common.h"
+#include "common/security/hmac_signer.h"
 #include "common/utils/retry.h"
 #include "networking/url.h"
 #include "networking/http/http_service.h"
@@ -27,12 +28,16 @@ namespace mb
 		static constexpr std::string_view _baseUrl = "https://api.kraken.com";
 
 		std::string _publicKey;
-		std::vector<unsigned char> _decodedPrivateKey;
+		hmac_signer _signer;
 		std::unique_ptr<http_service> _httpService;
+		std::unique_ptr<rate_limiter> _publicRateLimiter;
+		std::unique_ptr<rate_limiter> _privateRateLimiter;
+		std::unique_ptr<retry_policy> _retryPolicy;
 
 		std::string get_nonce() const;
 		std::string compute_api_sign(std::string_view uriPath, std::string_view postData, std::string_view nonce) const;
 		std::string build_kraken_path(std::string access, std::string method) const;
+		static std::pair<int, request_priority> private_request_cost(std::string_view method);
 
 		template<typename Value, typename ResponseReader>
 		Value send_public_request(std::string method, const ResponseReader& reader, std::string_view query = "") const
@@ -41,12 +46,23 @@ namespace mb
 			std::string url{ build_url(_baseUrl, path, query) };
 
 			http_request request{ http_verb::GET, std::move(url) };
-			return internal::send_http_request<Value>(*_httpService, request, reader);
+			return internal::send_http_request<Value>(*_httpService, request, reader, *_publicRateLimiter, *_retryPolicy);
+		}
+
+		template<typename Value, typename ResponseReader>
+		std::future<Value> send_public_request_async(std::string method, ResponseReader reader, std::string_view query = "") const
+		{
+			std::string path{ build_kraken_path("public", std::move(method)) };
+			http_request request{ http_verb::GET, build_url(_baseUrl, path, query) };
+			return internal::send_http_request_async<Value>(*_httpService, request, reader, *_publicRateLimiter, *_retryPolicy);
 		}
 
 		template<typename Value, typename ResponseReader>
 		Value send_private_request(std::string method, const ResponseReader& reader, std::string_view query = "") const
 		{
+			auto [weight, priority] = private_request_cost(method);
+			_privateRateLimiter->acquire(weight, priority);
+
 			std::string nonce{ get_nonce() };
 			std::string postData{ "nonce=" + nonce};
 			
@@ -67,7 +83,7 @@ namespace mb
 			request.add_header(common_http_headers::ACCEPT, common_http_headers::APPLICATION_JSON);
 			request.set_content(postData);
 
-			return internal::send_http_request<Value>(*_httpService, request, reader);
+			return internal::send_acquired_http_request<Value>(*_httpService, request, reader, *_privateRateLimiter);
 		}
 
 	public:
@@ -81,8 +97,9 @@ namespace mb
 		std::vector<tradable_pair> get_tradable_pairs() const override;
 		std::vector<ohlcv_data> get_ohlcv(const tradable_pair& tradablePair, ohlcv_interval interval, int count) const override;
 		double get_price(const tradable_pair& tradablePair) const override;
-		std::unordered_map<tradable_pair, double> get_prices(const std::vector<tradable_pair>& pairs) const;
+		std::unordered_map<tradable_pair, double> get_prices(const std::vector<tradable_pair>& pairs) const override;
 		order_book_state get_order_book(const tradable_pair& tradablePair, int depth) const override;
+		std::unordered_map<tradable_pair, order_book_state> get_order_books(const std::vector<tradable_pair>& pairs, int depth) const override;
 		double get_fee(const tradable_pair& tradablePair) const override;
 		std::unordered_map<std::string,double> get_balances() const override;
 		std::vector<order_description> get_open_orders() const override;
@@ -92,5 +109,5 @@ namespace mb
 	};
 
 	template<>
-	std::unique_ptr<exchange> create_exchange_api<kraken_api>(bool testing);
+	std::unique_ptr<exchange> create_exchange_api<kraken_api>(bool testing, bool websocketCompression);
 } 
\ No newline at end of file
@@ -106,6 +106,16 @@ namespace mb
 		{
 			return _tradeApi->cancel_order(orderId);
 		}
+
+		std::future<std::string> add_order_async(const order_request& description) override
+		{
+			return _tradeApi->add_order_async(description);
+		}
+
+		std::future<void> cancel_order_async(std::string_view orderId) override
+		{
+			return _tradeApi->cancel_order_async(orderId);
+		}
 	};
 
 	using live_test_exchange = multi_component_exchange<exchange, paper_trade_api>;
@@ -71,7 +71,7 @@ namespace mb
 	}
 
 	template<>
-	std::unique_ptr<exchange> create_exchange_api<template_api>(bool testing)
+	std::unique_ptr<exchange> create_exchange_api<template_api>(bool testing, bool websocketCompression)
 	{
 		return std::make_unique<template_api>(
 			internal::load_or_create_config<template_config>(),
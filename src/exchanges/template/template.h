@@ -32,5 +32,5 @@ namespace mb
 	};
 
 	template<>
-	std::unique_ptr<exchange> create_exchange_api<template_api>(bool testing);
+	std::unique_ptr<exchange> create_exchange_api<template_api>(bool testing, bool websocketCompression);
 }
\ No newline at end of file
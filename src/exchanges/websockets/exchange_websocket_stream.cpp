@@ -12,6 +12,24 @@ namespace
 	{
 		return std::move(pairName) + to_string(interval);
 	}
+
+	int activity_index(websocket_channel channel, ohlcv_interval interval)
+	{
+		switch (channel)
+		{
+		case websocket_channel::TRADE:
+			return 0;
+		case websocket_channel::ORDER_BOOK:
+			return 1;
+		default:
+			return 2 + static_cast<int>(interval);
+		}
+	}
+
+	long long steady_time_microseconds()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
 }
 
 namespace mb
@@ -30,6 +48,11 @@ namespace mb
 		initialise_connection_factory();
 	}
 
+	void exchange_websocket_stream::pair_record::record_message(websocket_channel channel, ohlcv_interval interval) const noexcept
+	{
+		lastMessageTimes[activity_index(channel, interval)].store(steady_time_microseconds(), std::memory_order_relaxed);
+	}
+
 	void exchange_websocket_stream::initialise_connection_factory()
 	{
 		_connectionFactory->set_on_open([this]() { on_open(); });
@@ -42,10 +65,35 @@ namespace mb
 		auto lockedTrades = _trades.unique_lock();
 		auto lockedOhlcv = _ohlcv.unique_lock();
 		auto lockedOrderBooks = _orderBooks.unique_lock();
+		auto lockedRecords = _pairRecords.unique_lock();
 
 		lockedTrades->clear();
 		lockedOhlcv->clear();
 		lockedOrderBooks->clear();
+
+		for (auto& [pairName, record] : *lockedRecords)
+		{
+			record.tradeHistory = nullptr;
+		}
+	}
+
+	const tradable_pair* exchange_websocket_stream::record_message(const std::string& pairName, websocket_channel channel, ohlcv_interval interval)
+	{
+		auto lockedRecords = _pairRecords.shared_lock();
+		auto it = lockedRecords->find(pairName);
+
+		if (it == lockedRecords->end())
+		{
+			return nullptr;
+		}
+
+		it->second.record_message(channel, interval);
+		return &it->second.pair;
+	}
+
+	void exchange_websocket_stream::log_unknown_pair(const std::string& pairName) const
+	{
+		logger::instance().warning("Websocket stream for exchange '{}' did not pass on an update for unsubscribed pair '{}'", _id, pairName);
 	}
 
 	void exchange_websocket_stream::on_open()
@@ -87,11 +135,16 @@ namespace mb
 	void exchange_websocket_stream::subscribe(const websocket_subscription& subscription)
 	{
 		{
-			auto lockedPairs = _pairs.unique_lock();
+			auto lockedRecords = _pairRecords.unique_lock();
 
 			for (auto& pair : subscription.pair_item())
 			{
-				lockedPairs->try_emplace(pair.to_string(_pairSeparator), pair);
+				pair_record& record{ lockedRecords->try_emplace(pair.to_string(_pairSeparator), pair).first->second };
+
+				if (subscription.channel() == websocket_channel::TRADE && !record.tradeHistory)
+				{
+					record.tradeHistory = std::make_shared<trade_history>(_tradeHistoryDepth);
+				}
 			}
 		}
 
@@ -103,6 +156,16 @@ namespace mb
 		send_unsubscribe(subscription);
 	}
 
+	const tradable_pair* exchange_websocket_stream::find_pair(const std::string& pairName) const
+	{
+		auto lockedRecords = _pairRecords.shared_lock();
+		auto it = lockedRecords->find(pairName);
+
+		return it != lockedRecords->end()
+			? &it->second.pair
+			: nullptr;
+	}
+
 	void exchange_websocket_stream::set_unsubscribed(const named_subscription& subscription)
 	{
 		switch (subscription.channel())
@@ -111,6 +174,14 @@ namespace mb
 		{
 			auto lockedTrades = _trades.unique_lock();
 			lockedTrades->erase(subscription.pair_item());
+
+			auto lockedRecords = _pairRecords.unique_lock();
+			auto recordIt = lockedRecords->find(subscription.pair_item());
+
+			if (recordIt != lockedRecords->end())
+			{
+				recordIt->second.tradeHistory = nullptr;
+			}
 			break;
 		}
 		case websocket_channel::OHLCV:
@@ -132,45 +203,84 @@ namespace mb
 
 	void exchange_websocket_stream::update_trade(std::string pairName, trade_update trade)
 	{
+		const tradable_pair* pair{ nullptr };
+
+		{
+			// The pair, its message times and its trade history come from the one record lookup
+			auto lockedRecords = _pairRecords.shared_lock();
+			auto recordIt = lockedRecords->find(pairName);
+
+			if (recordIt != lockedRecords->end())
+			{
+				const pair_record& record{ recordIt->second };
+				record.record_message(websocket_channel::TRADE, ohlcv_interval::UNKNOWN);
+
+				if (record.tradeHistory)
+				{
+					record.tradeHistory->push(trade);
+				}
+
+				pair = &record.pair;
+			}
+		}
+
 		{
 			auto lockedTrades = _trades.unique_lock();
 			lockedTrades->insert_or_assign(pairName, trade);
 		}
-		
-		if (has_trade_update_handler())
+
+		if (!pair)
+		{
+			log_unknown_pair(pairName);
+		}
+		else if (has_trade_update_handler())
 		{
-			fire_trade_update(trade_update_message{ _pairs.shared_lock()->at(pairName), std::move(trade)});
+			fire_trade_update(trade_update_message{ *pair, std::move(trade) });
 		}
 	}
 
-	void exchange_websocket_stream::update_ohlcv(std::string pairName, ohlcv_interval interval, ohlcv_data ohlcvData)
+	void exchange_websocket_stream::update_ohlcv(const std::string& pairName, ohlcv_interval interval, ohlcv_data ohlcvData)
 	{
+		const tradable_pair* pair{ record_message(pairName, websocket_channel::OHLCV, interval) };
+
 		{
 			auto lockedOhlcv = _ohlcv.unique_lock();
 			lockedOhlcv->insert_or_assign(create_ohlcv_sub_id(pairName, interval), ohlcvData);
 		}
 
-		if (has_ohlcv_update_handler())
+		if (!pair)
+		{
+			log_unknown_pair(pairName);
+		}
+		else if (has_ohlcv_update_handler())
 		{
-			fire_ohlcv_update(ohlcv_update_message{ _pairs.shared_lock()->at(pairName), interval, std::move(ohlcvData) });
+			fire_ohlcv_update(ohlcv_update_message{ *pair, interval, std::move(ohlcvData) });
 		}
 	}
 
 	void exchange_websocket_stream::initialise_order_book(std::string pairName, order_book_cache cache)
 	{
+		const tradable_pair* pair{ record_message(pairName, websocket_channel::ORDER_BOOK) };
+
 		{
 			auto lockedOrderBooks = _orderBooks.unique_lock();
 			lockedOrderBooks->insert_or_assign(pairName, std::move(cache));
 		}
 
-		if (has_order_book_update_handler())
+		if (!pair)
 		{
-			fire_order_book_update(order_book_update_message{ _pairs.shared_lock()->at(pairName), order_book_entry{ 0, 0, order_book_side::ASK } });
+			log_unknown_pair(pairName);
+		}
+		else if (has_order_book_update_handler())
+		{
+			fire_order_book_update(order_book_update_message{ *pair, order_book_entry{ 0, 0, order_book_side::ASK }, true });
 		}
 	}
 
 	void exchange_websocket_stream::update_order_book(std::string pairName, std::time_t timeStamp, order_book_entry entry)
 	{
+		const tradable_pair* pair{ record_message(pairName, websocket_channel::ORDER_BOOK) };
+
 		{
 			auto lockedOrderBooks = _orderBooks.unique_lock();
 
@@ -183,9 +293,13 @@ namespace mb
 			cacheIt->second.update_cache(timeStamp, entry);
 		}
 		
-		if (has_order_book_update_handler())
+		if (!pair)
 		{
-			fire_order_book_update(order_book_update_message{ _pairs.shared_lock()->at(pairName), std::move(entry) });
+			log_unknown_pair(pairName);
+		}
+		else if (has_order_book_update_handler())
+		{
+			fire_order_book_update(order_book_update_message{ *pair, std::move(entry) });
 		}
 	}
 
@@ -246,4 +360,46 @@ namespace mb
 		auto lockedOhlcv = _ohlcv.shared_lock();
 		return find_or_default<ohlcv_data>(*lockedOhlcv, subId);
 	}
+
+	std::shared_ptr<const trade_history> exchange_websocket_stream::get_trade_history(const tradable_pair& pair) const
+	{
+		auto lockedRecords = _pairRecords.shared_lock();
+		auto it = lockedRecords->find(pair.to_string(_pairSeparator));
+
+		return it != lockedRecords->end()
+			? it->second.tradeHistory
+			: nullptr;
+	}
+
+	latency_summary exchange_websocket_stream::get_round_trip_times() const
+	{
+		if (!_connection)
+		{
+			return latency_summary{};
+		}
+
+		return _connection->round_trip_times();
+	}
+
+	std::chrono::milliseconds exchange_websocket_stream::get_message_age(const unique_websocket_subscription& subscription) const
+	{
+		ohlcv_interval interval{ subscription.channel() == websocket_channel::OHLCV ? subscription.get_ohlcv_interval() : ohlcv_interval::UNKNOWN };
+
+		auto lockedRecords = _pairRecords.shared_lock();
+		auto it = lockedRecords->find(subscription.pair_item().to_string(_pairSeparator));
+
+		if (it == lockedRecords->end())
+		{
+			return std::chrono::milliseconds::max();
+		}
+
+		long long lastMessageTime{ it->second.lastMessageTimes[activity_index(subscription.channel(), interval)].load(std::memory_order_relaxed) };
+
+		if (lastMessageTime == 0)
+		{
+			return std::chrono::milliseconds::max();
+		}
+
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::microseconds{ steady_time_microseconds() - lastMessageTime });
+	}
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <unordered_map>
+#include <array>
+#include <atomic>
 
 #include "websocket_stream.h"
 #include "order_book_cache.h"
@@ -23,7 +25,30 @@ namespace mb
 		concurrent_wrapper<std::unordered_map<std::string, ohlcv_data>> _ohlcv;
 		concurrent_wrapper<std::unordered_map<std::string, order_book_cache>> _orderBooks;
 
+		// Steady clock time in microseconds of the last message per pair, indexed by activity_index
+		using message_times = std::array<std::atomic<long long>, 2 + static_cast<int>(ohlcv_interval::UNKNOWN)>;
+
+		// Everything an update message needs about a subscribed pair, so it is found with one lookup. Records are
+		// never erased, so update messages can reference the pair for the lifetime of the stream. The trade history
+		// is only set while the pair's trades are subscribed, and is read and replaced under the lock
+		struct pair_record
+		{
+			tradable_pair pair;
+			mutable message_times lastMessageTimes{};
+			std::shared_ptr<trade_history> tradeHistory;
+
+			explicit pair_record(tradable_pair pair)
+				: pair{ std::move(pair) }
+			{}
+
+			void record_message(websocket_channel channel, ohlcv_interval interval) const noexcept;
+		};
+
+		concurrent_wrapper<std::unordered_map<std::string, pair_record>> _pairRecords;
+
 		void initialise_connection_factory();
+		const tradable_pair* record_message(const std::string& pairName, websocket_channel channel, ohlcv_interval interval = ohlcv_interval::UNKNOWN);
+		void log_unknown_pair(const std::string& pairName) const;
 		void clear_subscriptions();
 
 		void on_open();
@@ -34,12 +59,12 @@ namespace mb
 		virtual void send_unsubscribe(const websocket_subscription& subscription) = 0;
 
 	protected:
-		concurrent_wrapper<std::unordered_map<std::string, tradable_pair>> _pairs;
 		std::unique_ptr<websocket_connection> _connection;
 
+		const tradable_pair* find_pair(const std::string& pairName) const;
 		void set_unsubscribed(const named_subscription& subscription);
 		void update_trade(std::string pairName, trade_update trade);
-		void update_ohlcv(std::string pairName, ohlcv_interval interval, ohlcv_data ohlcvData);
+		void update_ohlcv(const std::string& pairName, ohlcv_interval interval, ohlcv_data ohlcvData);
 		void initialise_order_book(std::string pairName, order_book_cache cache);
 		void update_order_book(std::string pairName, std::time_t timeStamp, order_book_entry entry);
 
@@ -65,12 +90,16 @@ namespace mb
 		order_book_state get_order_book(const tradable_pair& pair, int depth = 0) const override;
 		trade_update get_last_trade(const tradable_pair& pair) const override;
 		ohlcv_data get_last_candle(const tradable_pair& pair, ohlcv_interval interval) const override;
+		std::shared_ptr<const trade_history> get_trade_history(const tradable_pair& pair) const override;
+
+		latency_summary get_round_trip_times() const override;
+		std::chrono::milliseconds get_message_age(const unique_websocket_subscription& subscription) const override;
 	};
 
 	template<typename Implementation>
-	std::unique_ptr<websocket_stream> create_exchange_websocket_stream()
+	std::unique_ptr<websocket_stream> create_exchange_websocket_stream(bool compression = false)
 	{
 		return std::make_unique<Implementation>(
-			std::make_unique<websocket_connection_factory>());
+			std::make_unique<websocket_connection_factory>(compression));
 	}
 }
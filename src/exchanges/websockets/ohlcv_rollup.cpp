@@ -0,0 +1,231 @@
+#include <algorithm>
+
+#include "ohlcv_rollup.h"
+
+namespace mb
+{
+	namespace
+	{
+		constexpr int MINUTE_LEVEL = static_cast<int>(ohlcv_interval::M1);
+	}
+
+	void ohlcv_rollup::candle_aggregate::add(double price, double tradeVolume)
+	{
+		if (empty)
+		{
+			open = price;
+			high = price;
+			low = price;
+			empty = false;
+		}
+		else
+		{
+			high = std::max(high, price);
+			low = std::min(low, price);
+		}
+
+		close = price;
+		volume += tradeVolume;
+	}
+
+	void ohlcv_rollup::candle_aggregate::merge(const candle_aggregate& later)
+	{
+		if (later.empty)
+		{
+			return;
+		}
+
+		if (empty)
+		{
+			*this = later;
+			return;
+		}
+
+		high = std::max(high, later.high);
+		low = std::min(low, later.low);
+		close = later.close;
+		volume += later.volume;
+	}
+
+	void ohlcv_rollup::roll(std::time_t time)
+	{
+		candle_aggregate finished{};
+
+		for (int i = 0; i < LEVEL_COUNT; ++i)
+		{
+			level& lvl{ _levels[i] };
+
+			if (!lvl.active)
+			{
+				continue;
+			}
+
+			lvl.closed.merge(finished);
+			finished = candle_aggregate{};
+
+			int interval{ to_seconds(static_cast<ohlcv_interval>(i)) };
+
+			if (lvl.startTime < 0)
+			{
+				lvl.startTime = time - time % interval;
+				continue;
+			}
+
+			if (time < lvl.startTime + interval)
+			{
+				continue;
+			}
+
+			candle_aggregate window{ lvl.seed };
+			window.merge(lvl.closed);
+
+			finished = lvl.closed;
+			lvl.closed = candle_aggregate{};
+			lvl.startTime += ((time - lvl.startTime) / interval) * interval;
+
+			// An empty window carries the previous close, unless a trade opens it
+			lvl.seed = candle_aggregate{};
+
+			if (!window.empty && time != lvl.startTime)
+			{
+				lvl.seed.add(window.close, 0.0);
+			}
+		}
+	}
+
+	void ohlcv_rollup::reseed()
+	{
+		std::array<candle_aggregate, LEVEL_COUNT> data;
+		aggregate_levels(data);
+
+		for (int i = 0; i < LEVEL_COUNT; ++i)
+		{
+			_levels[i].seed = data[i];
+			_levels[i].closed = candle_aggregate{};
+		}
+	}
+
+	void ohlcv_rollup::aggregate_levels(std::array<candle_aggregate, LEVEL_COUNT>& data) const
+	{
+		candle_aggregate live{};
+
+		for (int i = 0; i < LEVEL_COUNT; ++i)
+		{
+			const level& lvl{ _levels[i] };
+
+			if (!lvl.active)
+			{
+				continue;
+			}
+
+			candle_aggregate levelLive{ lvl.closed };
+			levelLive.merge(live);
+			live = levelLive;
+
+			data[i] = lvl.seed;
+			data[i].merge(live);
+		}
+	}
+
+	ohlcv_data ohlcv_rollup::to_ohlcv(int index, const candle_aggregate& data) const
+	{
+		const level& lvl{ _levels[index] };
+
+		if (data.empty)
+		{
+			return lvl.lastEmitted;
+		}
+
+		return ohlcv_data
+		{
+			lvl.startTime, data.open, data.high, data.low, data.close, data.volume
+		};
+	}
+
+	bool ohlcv_rollup::push_trade(std::time_t time, double price, double volume)
+	{
+		level& minuteLevel{ _levels[MINUTE_LEVEL] };
+
+		if (!minuteLevel.active || (minuteLevel.startTime >= 0 && time < minuteLevel.startTime))
+		{
+			return false;
+		}
+
+		roll(time);
+		minuteLevel.closed.add(price, volume);
+		return true;
+	}
+
+	bool ohlcv_rollup::candle_changed(const ohlcv_data& previous, const ohlcv_data& current) noexcept
+	{
+		return
+			previous.time_stamp() != current.time_stamp() ||
+			previous.open() != current.open() ||
+			previous.high() != current.high() ||
+			previous.low() != current.low() ||
+			previous.close() != current.close() ||
+			previous.volume() != current.volume();
+	}
+
+	bool ohlcv_rollup::empty() const noexcept
+	{
+		return std::none_of(_levels.begin(), _levels.end(), [](const level& lvl) { return lvl.subscribed; });
+	}
+
+	bool ohlcv_rollup::is_subscribed(ohlcv_interval interval) const noexcept
+	{
+		return interval != ohlcv_interval::UNKNOWN && _levels[static_cast<int>(interval)].subscribed;
+	}
+
+	void ohlcv_rollup::add_interval(ohlcv_interval interval, const ohlcv_data& latestOhlcv)
+	{
+		// Folded candles are moved into each level's seed so the new level does not double count them
+		reseed();
+
+		level& lvl{ _levels[static_cast<int>(interval)] };
+		lvl = level{};
+		lvl.active = true;
+		lvl.subscribed = true;
+		lvl.startTime = latestOhlcv.time_stamp();
+		lvl.lastEmitted = latestOhlcv;
+
+		if (latestOhlcv.time_stamp() >= 0)
+		{
+			lvl.seed = candle_aggregate{ latestOhlcv.open(), latestOhlcv.high(), latestOhlcv.low(), latestOhlcv.close(), latestOhlcv.volume(), false };
+		}
+
+		_levels[MINUTE_LEVEL].active = true;
+	}
+
+	void ohlcv_rollup::remove_interval(ohlcv_interval interval)
+	{
+		if (!is_subscribed(interval))
+		{
+			return;
+		}
+
+		reseed();
+
+		int index{ static_cast<int>(interval) };
+		_levels[index].subscribed = false;
+
+		if (index != MINUTE_LEVEL)
+		{
+			_levels[index] = level{};
+		}
+
+		if (empty())
+		{
+			_levels = std::array<level, LEVEL_COUNT>{};
+		}
+	}
+
+	ohlcv_data ohlcv_rollup::get_ohlcv(ohlcv_interval interval) const
+	{
+		std::array<candle_aggregate, LEVEL_COUNT> data;
+		aggregate_levels(data);
+
+		int index{ static_cast<int>(interval) };
+		return to_ohlcv(index, data[index]);
+	}
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+
+#include "websocket_stream_constants.h"
+#include "trading/ohlcv_data.h"
+
+namespace mb
+{
+	class ohlcv_rollup
+	{
+	private:
+		static constexpr int LEVEL_COUNT = static_cast<int>(ohlcv_interval::UNKNOWN);
+
+		struct candle_aggregate
+		{
+			double open{};
+			double high{};
+			double low{};
+			double close{};
+			double volume{};
+			bool empty{ true };
+
+			void add(double price, double tradeVolume);
+			void merge(const candle_aggregate& later);
+		};
+
+		struct level
+		{
+			std::time_t startTime{ -1 };
+			candle_aggregate seed{};
+			candle_aggregate closed{};
+			ohlcv_data lastEmitted{};
+			bool active{};
+			bool subscribed{};
+		};
+
+		// Indexed by ohlcv_interval, finest first. Trades are only added to the M1 level,
+		// coarser levels are derived from the finished candles of the level below
+		std::array<level, LEVEL_COUNT> _levels;
+
+		void roll(std::time_t time);
+		void reseed();
+		void aggregate_levels(std::array<candle_aggregate, LEVEL_COUNT>& data) const;
+		ohlcv_data to_ohlcv(int index, const candle_aggregate& data) const;
+		bool push_trade(std::time_t time, double price, double volume);
+
+		static bool candle_changed(const ohlcv_data& previous, const ohlcv_data& current) noexcept;
+
+	public:
+		bool empty() const noexcept;
+		bool is_subscribed(ohlcv_interval interval) const noexcept;
+
+		void add_interval(ohlcv_interval interval, const ohlcv_data& latestOhlcv);
+		void remove_interval(ohlcv_interval interval);
+
+		ohlcv_data get_ohlcv(ohlcv_interval interval) const;
+
+		template<typename OnUpdate>
+		void add_trade(std::time_t time, double price, double volume, const OnUpdate& onUpdate)
+		{
+			if (!push_trade(time, price, volume))
+			{
+				return;
+			}
+
+			std::array<candle_aggregate, LEVEL_COUNT> data;
+			aggregate_levels(data);
+
+			for (int i = 0; i < LEVEL_COUNT; ++i)
+			{
+				level& lvl{ _levels[i] };
+
+				if (!lvl.subscribed)
+				{
+					continue;
+				}
+
+				ohlcv_data ohlcv{ to_ohlcv(i, data[i]) };
+
+				if (candle_changed(lvl.lastEmitted, ohlcv))
+				{
+					lvl.lastEmitted = ohlcv;
+					onUpdate(static_cast<ohlcv_interval>(i), ohlcv);
+				}
+			}
+		}
+	};
+}
@@ -19,7 +19,6 @@ namespace mb
 	void ohlcv_subscription_service::add_subscription(const websocket_subscription& subscription)
 	{
 		ohlcv_interval ohlcvInterval{ subscription.get_ohlcv_interval() };
-		int interval{ to_seconds(ohlcvInterval) };
 
 		for (auto& pair : subscription.pair_item())
 		{
@@ -28,8 +27,8 @@ namespace mb
 
 			std::string pairName{ pair.to_string(_pairSeparator) };
 
-			_subscriptions[pairName].emplace(ohlcvInterval, ohlcv_from_trades{ latestOhlcv, interval });
-			_updateOhlcv(std::move(pairName), ohlcvInterval, std::move(latestOhlcv));
+			_subscriptions[pairName].add_interval(ohlcvInterval, latestOhlcv);
+			_updateOhlcv(pairName, ohlcvInterval, latestOhlcv);
 		}
 	}
 
@@ -39,13 +38,18 @@ namespace mb
 
 		for (auto& pair : subscription.pair_item())
 		{
-			std::string pairName{ pair.to_string(_pairSeparator) };
-			
-			_subscriptions[pairName].erase(interval);
-			
-			if (_subscriptions[pairName].empty())
+			auto it = _subscriptions.find(pair.to_string(_pairSeparator));
+
+			if (it == _subscriptions.end())
 			{
-				_subscriptions.erase(pairName);
+				continue;
+			}
+
+			it->second.remove_interval(interval);
+
+			if (it->second.empty())
+			{
+				_subscriptions.erase(it);
 			}
 		}
 	}
@@ -59,12 +63,11 @@ namespace mb
 			throw mb_exception{ fmt::format("OHLCV is not subscribed for pair {}", pairName) };
 		}
 
-		std::unordered_map<ohlcv_interval, ohlcv_from_trades>& ohlcvFromTrades{ it->second };
+		const std::string& subscribedPairName{ it->first };
 
-		for (auto& [interval, oft] : ohlcvFromTrades)
+		it->second.add_trade(time, price, volume, [this, &subscribedPairName](ohlcv_interval interval, const ohlcv_data& ohlcv)
 		{
-			oft.add_trade(time, price, volume);
-			_updateOhlcv(std::string{ pairName }, interval, oft.get_ohlcv(time));
-		}
+			_updateOhlcv(subscribedPairName, interval, ohlcv);
+		});
 	}
 }
\ No newline at end of file
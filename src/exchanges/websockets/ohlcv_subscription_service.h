@@ -4,16 +4,16 @@
 #include <functional>
 
 #include "exchanges/exchange.h"
-#include "trading/ohlcv_from_trades.h"
+#include "ohlcv_rollup.h"
 
 namespace mb
 {
 	class ohlcv_subscription_service
 	{
 	private:
-		using update_ohlcv_function = std::function<void(std::string, ohlcv_interval, ohlcv_data)>;
+		using update_ohlcv_function = std::function<void(const std::string&, ohlcv_interval, const ohlcv_data&)>;
 
-		std::unordered_map<std::string,std::unordered_map<ohlcv_interval, ohlcv_from_trades>> _subscriptions;
+		std::unordered_map<std::string, ohlcv_rollup> _subscriptions;
 		std::unique_ptr<market_api> _marketApi;
 		update_ohlcv_function _updateOhlcv;
 		char _pairSeparator;
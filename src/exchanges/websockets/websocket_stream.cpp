@@ -1,4 +1,5 @@
 #include "websocket_stream.h"
+#include "common/utils/generalutils.h"
 
 namespace
 {
@@ -29,6 +30,20 @@ namespace mb
 		_orderBookUpdateHandlers.emplace_back(std::move(handler));
 	}
 
+	std::vector<trade_update> websocket_stream::get_recent_trades(const tradable_pair& pair, int count) const
+	{
+		assert_throw(count >= 0, "Recent trade count cannot be negative");
+
+		std::shared_ptr<const trade_history> history{ get_trade_history(pair) };
+
+		if (!history)
+		{
+			return {};
+		}
+
+		return history->get_trades(count);
+	}
+
 	bool websocket_stream::has_trade_update_handler()
 	{
 		return !_tradeUpdateHandlers.empty();
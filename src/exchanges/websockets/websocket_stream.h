@@ -7,6 +7,7 @@
 #include "trading/order_book.h"
 #include "trading/ohlcv_data.h"
 #include "trading/trade_update.h"
+#include "trading/trade_history.h"
 #include "common/types/set_queue.h"
 
 namespace mb
@@ -20,6 +21,11 @@ namespace mb
 
 		virtual ~websocket_stream() = default;
 
+		inline static void set_trade_history_depth(int depth) noexcept
+		{
+			_tradeHistoryDepth = depth;
+		}
+
 		virtual void reset() = 0;
 		virtual void disconnect() = 0;
 		virtual ws_connection_status connection_status() const = 0;
@@ -31,12 +37,20 @@ namespace mb
 		virtual order_book_state get_order_book(const tradable_pair& pair, int depth = 0) const = 0;
 		virtual trade_update get_last_trade(const tradable_pair& pair) const = 0;
 		virtual ohlcv_data get_last_candle(const tradable_pair& pair, ohlcv_interval interval) const = 0;
+		virtual std::shared_ptr<const trade_history> get_trade_history(const tradable_pair& pair) const = 0;
+
+		virtual latency_summary get_round_trip_times() const = 0;
+		virtual std::chrono::milliseconds get_message_age(const unique_websocket_subscription& subscription) const = 0;
+
+		std::vector<trade_update> get_recent_trades(const tradable_pair& pair, int count = 0) const;
 
 		void add_trade_update_handler(trade_update_handler handler);
 		void add_ohlcv_update_handler(ohlcv_update_handler handler);
 		void add_order_book_update_handler(order_book_update_handler handler);
 
 	protected:
+		inline static int _tradeHistoryDepth = 100;
+
 		bool has_trade_update_handler();
 		bool has_ohlcv_update_handler();
 		bool has_order_book_update_handler();
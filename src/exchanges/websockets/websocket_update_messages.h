@@ -8,34 +8,36 @@
 
 namespace mb
 {
+	// Messages reference the tradable_pair owned by the firing stream, which outlives the subscription
+
 	class trade_update_message
 	{
 	private:
-		tradable_pair _pair;
+		const tradable_pair* _pair;
 		trade_update _trade;
 
 	public:
-		trade_update_message(tradable_pair pair, trade_update trade)
-			: _pair{ std::move(pair) }, _trade{ std::move(trade) }
+		trade_update_message(const tradable_pair& pair, trade_update trade)
+			: _pair{ &pair }, _trade{ std::move(trade) }
 		{}
 
-		const tradable_pair& pair() const noexcept { return _pair; }
+		const tradable_pair& pair() const noexcept { return *_pair; }
 		const trade_update& trade() const noexcept { return _trade; }
 	};
 
 	class ohlcv_update_message
 	{
 	private:
-		tradable_pair _pair;
+		const tradable_pair* _pair;
 		ohlcv_interval _interval;
 		ohlcv_data _ohlcv;
 
 	public:
-		ohlcv_update_message(tradable_pair pair, ohlcv_interval interval, ohlcv_data data)
-			: _pair{ std::move(pair) }, _interval{ interval }, _ohlcv{ std::move(data) }
+		ohlcv_update_message(const tradable_pair& pair, ohlcv_interval interval, ohlcv_data data)
+			: _pair{ &pair }, _interval{ interval }, _ohlcv{ std::move(data) }
 		{}
 
-		const tradable_pair& pair() const noexcept { return _pair; }
+		const tradable_pair& pair() const noexcept { return *_pair; }
 		ohlcv_interval interval() const noexcept { return _interval; }
 		const ohlcv_data& ohlcv() const noexcept { return _ohlcv; }
 	};
@@ -43,15 +45,20 @@ namespace mb
 	class order_book_update_message
 	{
 	private:
-		tradable_pair _pair;
+		const tradable_pair* _pair;
 		order_book_entry _entry;
+		bool _startsSnapshot;
 
 	public:
-		order_book_update_message(tradable_pair pair, order_book_entry entry)
-			: _pair{ std::move(pair) }, _entry{ std::move(entry) }
+		order_book_update_message(const tradable_pair& pair, order_book_entry entry, bool startsSnapshot = false)
+			: _pair{ &pair }, _entry{ std::move(entry) }, _startsSnapshot{ startsSnapshot }
 		{}
 
-		const tradable_pair& pair() const noexcept { return _pair; }
+		const tradable_pair& pair() const noexcept { return *_pair; }
 		const order_book_entry& entry() const noexcept { return _entry; }
+
+		// Set when the book was replaced by a new snapshot, so any copy kept from earlier updates should be cleared
+		// before this entry is applied
+		bool starts_snapshot() const noexcept { return _startsSnapshot; }
 	};
 }
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include "async_http_client.h"
+#include "curl_common.h"
+#include "http_connection_pool.h"
+#include "response_buffer_pool.h"
+
+namespace
+{
+	constexpr int POLL_TIMEOUT_MS = 1000;
+}
+
+namespace mb
+{
+	async_http_client::async_http_client()
+		:
+		_multiHandle{ nullptr },
+		_mutex{},
+		_pending{},
+		_active{},
+		_running{ true },
+		_thread{}
+	{
+		// Constructed first so the shared caches and response buffers outlive every transfer started here
+		http_connection_pool::instance();
+		response_buffer_pool::instance();
+
+		_multiHandle = curl_multi_init();
+
+		if (!_multiHandle)
+		{
+			throw http_error{ "Could not create async HTTP client" };
+		}
+
+		_thread = std::thread{ &async_http_client::run, this };
+	}
+
+	async_http_client::~async_http_client()
+	{
+		_running = false;
+		curl_multi_wakeup(_multiHandle);
+		_thread.join();
+
+		std::exception_ptr shutdownError{ std::make_exception_ptr(http_error{ "Async HTTP client shut down" }) };
+
+		for (auto& [easyHandle, transfer] : _active)
+		{
+			curl_multi_remove_handle(_multiHandle, easyHandle);
+			transfer->promise.set_exception(shutdownError);
+			release(*transfer);
+		}
+
+		for (auto& transfer : _pending)
+		{
+			transfer->promise.set_exception(shutdownError);
+			release(*transfer);
+		}
+
+		curl_multi_cleanup(_multiHandle);
+	}
+
+	async_http_client& async_http_client::instance()
+	{
+		static async_http_client client;
+		return client;
+	}
+
+	std::future<http_response> async_http_client::send(const http_request& request, int timeout)
+	{
+		auto newTransfer = std::make_unique<transfer>();
+		newTransfer->easyHandle = internal::create_easy_handle();
+		newTransfer->content = request.content();
+		newTransfer->response.body = response_buffer_pool::instance().acquire();
+
+		if (!newTransfer->easyHandle)
+		{
+			throw http_error{ "Could not create HTTP request handle" };
+		}
+
+		CURL* easyHandle{ newTransfer->easyHandle };
+
+		try
+		{
+			http_connection_pool::instance().share(easyHandle);
+			internal::set_option(easyHandle, CURLOPT_WRITEFUNCTION, internal::write_callback);
+			internal::set_option(easyHandle, CURLOPT_WRITEDATA, &newTransfer->response);
+			internal::set_option(easyHandle, CURLOPT_HEADERFUNCTION, internal::header_callback);
+			internal::set_option(easyHandle, CURLOPT_HEADERDATA, &newTransfer->response);
+			internal::set_option(easyHandle, CURLOPT_TIMEOUT_MS, timeout);
+			internal::set_option(easyHandle, CURLOPT_URL, request.url().c_str());
+			internal::set_option(easyHandle, CURLOPT_CUSTOMREQUEST, to_string(request.verb()).data());
+			internal::set_option(easyHandle, CURLOPT_POSTFIELDS, newTransfer->content.c_str());
+
+			newTransfer->headers = internal::append_headers(NULL, request.headers());
+			internal::set_option(easyHandle, CURLOPT_HTTPHEADER, newTransfer->headers);
+		}
+		catch (...)
+		{
+			release(*newTransfer);
+			throw;
+		}
+
+		std::future<http_response> response{ newTransfer->promise.get_future() };
+
+		{
+			std::lock_guard<std::mutex> lock{ _mutex };
+			_pending.emplace_back(std::move(newTransfer));
+		}
+
+		curl_multi_wakeup(_multiHandle);
+		return response;
+	}
+
+	void async_http_client::run()
+	{
+		while (_running)
+		{
+			start_pending_transfers();
+
+			int runningHandles = 0;
+			curl_multi_perform(_multiHandle, &runningHandles);
+
+			complete_transfers();
+
+			curl_multi_poll(_multiHandle, nullptr, 0, POLL_TIMEOUT_MS, nullptr);
+		}
+	}
+
+	void async_http_client::start_pending_transfers()
+	{
+		std::vector<std::unique_ptr<transfer>> pending;
+
+		{
+			std::lock_guard<std::mutex> lock{ _mutex };
+			pending.swap(_pending);
+		}
+
+		for (auto& transfer : pending)
+		{
+			CURLMcode result{ curl_multi_add_handle(_multiHandle, transfer->easyHandle) };
+
+			if (result != CURLM_OK)
+			{
+				transfer->promise.set_exception(std::make_exception_ptr(http_error{ curl_multi_strerror(result) }));
+				release(*transfer);
+				continue;
+			}
+
+			_active.emplace(transfer->easyHandle, std::move(transfer));
+		}
+	}
+
+	void async_http_client::complete_transfers()
+	{
+		int messagesInQueue = 0;
+
+		while (CURLMsg* message = curl_multi_info_read(_multiHandle, &messagesInQueue))
+		{
+			if (message->msg != CURLMSG_DONE)
+			{
+				continue;
+			}
+
+			auto it = _active.find(message->easy_handle);
+
+			if (it == _active.end())
+			{
+				continue;
+			}
+
+			std::unique_ptr<transfer> completed{ std::move(it->second) };
+			_active.erase(it);
+
+			CURLcode result{ message->data.result };
+			curl_multi_remove_handle(_multiHandle, completed->easyHandle);
+
+			if (result == CURLE_OK)
+			{
+				long responseCode;
+				curl_easy_getinfo(completed->easyHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+
+				completed->promise.set_value(http_response{ static_cast<int>(responseCode), std::move(completed->response.body), std::move(completed->response.headers) });
+			}
+			else
+			{
+				completed->promise.set_exception(std::make_exception_ptr(http_error{ curl_easy_strerror(result) }));
+			}
+
+			release(*completed);
+		}
+	}
+
+	void async_http_client::release(transfer& transfer)
+	{
+		curl_slist_free_all(transfer.headers);
+		curl_easy_cleanup(transfer.easyHandle);
+
+		transfer.headers = nullptr;
+		transfer.easyHandle = nullptr;
+	}
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <curl/curl.h>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+
+#include "http_request.h"
+#include "http_response.h"
+#include "curl_common.h"
+
+namespace mb
+{
+	// Drives any number of in-flight requests from a single curl multi handle on one background thread
+	class async_http_client
+	{
+	private:
+		struct transfer
+		{
+			CURL* easyHandle = nullptr;
+			curl_slist* headers = nullptr;
+			std::string content;
+			internal::response_buffers response;
+			std::promise<http_response> promise;
+		};
+
+		CURLM* _multiHandle;
+		std::mutex _mutex;
+		std::vector<std::unique_ptr<transfer>> _pending;
+		std::unordered_map<CURL*, std::unique_ptr<transfer>> _active;
+		std::atomic_bool _running;
+		std::thread _thread;
+
+		async_http_client();
+
+		void run();
+		void start_pending_transfers();
+		void complete_transfers();
+		void release(transfer& transfer);
+
+	public:
+		~async_http_client();
+
+		async_http_client(const async_http_client&) = delete;
+		async_http_client(async_http_client&&) noexcept = delete;
+		async_http_client& operator=(const async_http_client&) = delete;
+		async_http_client& operator=(async_http_client&&) noexcept = delete;
+
+		static async_http_client& instance();
+
+		std::future<http_response> send(const http_request& request, int timeout);
+	};
+}
@@ -0,0 +1,122 @@
+#include <mutex>
+#include <string_view>
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+
+#include "curl_common.h"
+#include "response_buffer_pool.h"
+
+namespace
+{
+	bool is_content_length(std::string_view key)
+	{
+		constexpr std::string_view CONTENT_LENGTH = "content-length";
+
+		return std::equal(key.begin(), key.end(), CONTENT_LENGTH.begin(), CONTENT_LENGTH.end(), [](char a, char b)
+		{
+			return std::tolower(static_cast<unsigned char>(a)) == b;
+		});
+	}
+
+	// Sizes the body up front so large responses are written without reallocating. The length comes from the
+	// server, so the reservation is capped at what the buffer pool would keep and anything larger grows as written
+	void reserve_body(std::string& body, std::string_view contentLength) noexcept
+	{
+		size_t length;
+		auto [ptr, error] = std::from_chars(contentLength.data(), contentLength.data() + contentLength.size(), length);
+
+		if (error != std::errc{})
+		{
+			return;
+		}
+
+		try
+		{
+			body.reserve(std::min(length, mb::response_buffer_pool::MAX_RETAINED_CAPACITY));
+		}
+		catch (const std::bad_alloc&)
+		{
+			// Only an optimisation, so the body is left to grow as it is written
+		}
+	}
+}
+
+namespace mb::internal
+{
+	void global_init()
+	{
+		static std::once_flag initFlag;
+		std::call_once(initFlag, []() { curl_global_init(CURL_GLOBAL_ALL); });
+	}
+
+	CURL* create_easy_handle()
+	{
+		global_init();
+		return curl_easy_init();
+	}
+
+	size_t write_callback(char* ptr, size_t size, size_t nmemb, void* userdata) noexcept
+	{
+		auto buffers = static_cast<response_buffers*>(userdata);
+		size_t realSize = size * nmemb;
+
+		// Exceptions cannot cross libcurl, so returning short aborts the transfer with a write error instead
+		try
+		{
+			buffers->body->append(ptr, realSize);
+		}
+		catch (const std::exception&)
+		{
+			return 0;
+		}
+
+		return realSize;
+	}
+
+	size_t header_callback(char* buffer, size_t size, size_t nitems, void* userdata) noexcept
+	{
+		auto buffers = static_cast<response_buffers*>(userdata);
+		size_t realSize = size * nitems;
+
+		std::string_view line{ buffer, realSize };
+		size_t separator = line.find(':');
+
+		// Status lines and the blank line ending each header block have no separator
+		if (separator != std::string_view::npos)
+		{
+			std::string_view value{ line.substr(separator + 1) };
+			size_t valueStart = value.find_first_not_of(' ');
+			size_t valueEnd = value.find_last_not_of(" \r\n");
+
+			std::string_view key{ line.substr(0, separator) };
+			std::string_view trimmedValue{ valueStart == std::string_view::npos ? std::string_view{} : value.substr(valueStart, valueEnd - valueStart + 1) };
+
+			if (is_content_length(key))
+			{
+				reserve_body(*buffers->body, trimmedValue);
+			}
+
+			try
+			{
+				buffers->headers.emplace_back(std::string{ key }, std::string{ trimmedValue });
+			}
+			catch (const std::exception&)
+			{
+				return 0;
+			}
+		}
+
+		return realSize;
+	}
+
+	curl_slist* append_headers(curl_slist* chunk, const std::vector<http_header>& headers)
+	{
+		for (auto& header : headers)
+		{
+			chunk = curl_slist_append(chunk, header.to_string().c_str());
+		}
+
+		return chunk;
+	}
+}
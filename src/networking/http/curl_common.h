@@ -0,0 +1,41 @@
+#pragma once
+
+#include <curl/curl.h>
+#include <vector>
+#include <memory>
+#include <string>
+
+#include "http_header.h"
+#include "http_error.h"
+
+namespace mb::internal
+{
+	// Destination for one transfer's body and headers, passed to both curl callbacks
+	struct response_buffers
+	{
+		std::shared_ptr<std::string> body;
+		std::vector<http_header> headers;
+	};
+
+	void global_init();
+	CURL* create_easy_handle();
+	size_t write_callback(char* ptr, size_t size, size_t nmemb, void* userdata) noexcept;
+	size_t header_callback(char* buffer, size_t size, size_t nitems, void* userdata) noexcept;
+	curl_slist* append_headers(curl_slist* chunk, const std::vector<http_header>& headers);
+
+	inline void throw_if_error(CURLcode result)
+	{
+		if (result != CURLcode::CURLE_OK)
+		{
+			std::string error = curl_easy_strerror(result);
+			throw http_error{ std::move(error) };
+		}
+	}
+
+	template<typename... Args>
+	void set_option(CURL* handle, CURLoption option, Args&&... args)
+	{
+		CURLcode result = curl_easy_setopt(handle, option, std::forward<Args>(args)...);
+		throw_if_error(result);
+	}
+}
@@ -0,0 +1,126 @@
+#include "http_connection_pool.h"
+#include "curl_common.h"
+
+namespace mb
+{
+	void http_connection_pool::handle_releaser::operator()(CURL* handle) const
+	{
+		pool->release(handle);
+	}
+
+	http_connection_pool::http_connection_pool()
+		:
+		_shareHandle{ nullptr },
+		_shareLocks{},
+		_mutex{},
+		_idleHandles{}
+	{
+		internal::global_init();
+		_shareHandle = curl_share_init();
+
+		if (!_shareHandle)
+		{
+			throw http_error{ "Could not create HTTP connection pool" };
+		}
+
+		curl_share_setopt(_shareHandle, CURLSHOPT_LOCKFUNC, lock_share);
+		curl_share_setopt(_shareHandle, CURLSHOPT_UNLOCKFUNC, unlock_share);
+		curl_share_setopt(_shareHandle, CURLSHOPT_USERDATA, this);
+		curl_share_setopt(_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+		curl_share_setopt(_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+	}
+
+	http_connection_pool::~http_connection_pool()
+	{
+		for (CURL* handle : _idleHandles)
+		{
+			curl_easy_cleanup(handle);
+		}
+
+		curl_share_cleanup(_shareHandle);
+	}
+
+	http_connection_pool& http_connection_pool::instance()
+	{
+		static http_connection_pool pool;
+		return pool;
+	}
+
+	void http_connection_pool::lock_share(CURL*, curl_lock_data data, curl_lock_access, void* pool)
+	{
+		static_cast<http_connection_pool*>(pool)->_shareLocks[data].lock();
+	}
+
+	void http_connection_pool::unlock_share(CURL*, curl_lock_data data, void* pool)
+	{
+		static_cast<http_connection_pool*>(pool)->_shareLocks[data].unlock();
+	}
+
+	http_connection_pool::pooled_handle http_connection_pool::acquire()
+	{
+		{
+			std::lock_guard<std::mutex> lock{ _mutex };
+
+			if (!_idleHandles.empty())
+			{
+				CURL* handle{ _idleHandles.back() };
+				_idleHandles.pop_back();
+
+				return pooled_handle{ handle, handle_releaser{ this } };
+			}
+		}
+
+		CURL* handle{ internal::create_easy_handle() };
+
+		if (!handle)
+		{
+			throw http_error{ "Could not create HTTP request handle" };
+		}
+
+		try
+		{
+			internal::set_option(handle, CURLOPT_WRITEFUNCTION, internal::write_callback);
+			internal::set_option(handle, CURLOPT_HEADERFUNCTION, internal::header_callback);
+			share(handle);
+		}
+		catch (...)
+		{
+			curl_easy_cleanup(handle);
+			throw;
+		}
+
+		return pooled_handle{ handle, handle_releaser{ this } };
+	}
+
+	void http_connection_pool::share(CURL* handle)
+	{
+		internal::set_option(handle, CURLOPT_SHARE, _shareHandle);
+	}
+
+	void http_connection_pool::release(CURL* handle)
+	{
+		// Clear pointers into the previous request's buffers before the handle sits idle
+		curl_easy_setopt(handle, CURLOPT_WRITEDATA, nullptr);
+		curl_easy_setopt(handle, CURLOPT_HEADERDATA, nullptr);
+		curl_easy_setopt(handle, CURLOPT_POSTFIELDS, nullptr);
+		curl_easy_setopt(handle, CURLOPT_HTTPHEADER, nullptr);
+
+		{
+			std::lock_guard<std::mutex> lock{ _mutex };
+
+			if (_idleHandles.size() < MAX_IDLE_HANDLES)
+			{
+				_idleHandles.push_back(handle);
+				return;
+			}
+		}
+
+		curl_easy_cleanup(handle);
+	}
+
+	int http_connection_pool::idle_count()
+	{
+		std::lock_guard<std::mutex> lock{ _mutex };
+		return _idleHandles.size();
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <curl/curl.h>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mb
+{
+	// Hands out easy handles that share one DNS and TLS session cache, so new connections skip the lookup and
+	// resume sessions instead of fully re-handshaking. Connections themselves stay with the pooled easy handle or
+	// multi handle that opened them, as libcurl's shared connection cache is not safe across threads
+	class http_connection_pool
+	{
+	private:
+		struct handle_releaser
+		{
+			http_connection_pool* pool;
+			void operator()(CURL* handle) const;
+		};
+
+		static constexpr int MAX_IDLE_HANDLES = 16;
+
+		CURLSH* _shareHandle;
+		std::array<std::mutex, CURL_LOCK_DATA_LAST> _shareLocks;
+		std::mutex _mutex;
+		std::vector<CURL*> _idleHandles;
+
+		http_connection_pool();
+
+		static void lock_share(CURL*, curl_lock_data data, curl_lock_access, void* pool);
+		static void unlock_share(CURL*, curl_lock_data data, void* pool);
+
+		void release(CURL* handle);
+
+	public:
+		using pooled_handle = std::unique_ptr<CURL, handle_releaser>;
+
+		~http_connection_pool();
+
+		http_connection_pool(const http_connection_pool&) = delete;
+		http_connection_pool(http_connection_pool&&) noexcept = delete;
+		http_connection_pool& operator=(const http_connection_pool&) = delete;
+		http_connection_pool& operator=(http_connection_pool&&) noexcept = delete;
+
+		static http_connection_pool& instance();
+
+		pooled_handle acquire();
+		void share(CURL* handle);
+		int idle_count();
+	};
+}
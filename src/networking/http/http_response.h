@@ -1,6 +1,14 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <algorithm>
+#include <cctype>
+
+#include "http_header.h"
 
 namespace mb
 {
@@ -8,14 +16,44 @@ namespace mb
 	{
 	private:
 		int _responseCode;
-		std::string _message;
+		std::shared_ptr<const std::string> _message;
+		std::vector<http_header> _headers;
 
 	public:
-		http_response(int responseCode, std::string message)
-			: _responseCode{ responseCode }, _message{ std::move(message) }
+		http_response(int responseCode, std::string message, std::vector<http_header> headers = {})
+			: 
+			_responseCode{ responseCode }, 
+			_message{ std::make_shared<const std::string>(std::move(message)) }, 
+			_headers{ std::move(headers) }
+		{}
+
+		// Shares the body rather than copying it, so pooled buffers can be handed straight to readers
+		http_response(int responseCode, std::shared_ptr<const std::string> message, std::vector<http_header> headers = {})
+			: _responseCode{ responseCode }, _message{ std::move(message) }, _headers{ std::move(headers) }
 		{}
 
 		int response_code() const noexcept { return _responseCode; }
-		const std::string& message() const noexcept { return _message; }
+		const std::string& message() const noexcept { return *_message; }
+		std::string_view body() const noexcept { return *_message; }
+		const std::vector<http_header>& headers() const noexcept { return _headers; }
+
+		// Header names are case-insensitive
+		std::optional<std::string_view> header(std::string_view key) const
+		{
+			auto it = std::find_if(_headers.begin(), _headers.end(), [key](const http_header& header)
+			{
+				return std::equal(header.key().begin(), header.key().end(), key.begin(), key.end(), [](char a, char b)
+				{
+					return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+				});
+			});
+
+			if (it == _headers.end())
+			{
+				return std::nullopt;
+			}
+
+			return it->value();
+		}
 	};
-}
\ No newline at end of file
+}
@@ -5,6 +5,7 @@
 #include <memory>
 #include <string_view>
 #include <utility>
+#include <future>
 
 #include "http_response.h"
 #include "http_request.h"
@@ -14,24 +15,17 @@ namespace mb
 	class http_service
 	{
 	private:
-		CURL* _easyHandle;
 		inline static int _timeout;
 
 	public:
-		http_service();
-		virtual ~http_service();
+		virtual ~http_service() = default;
 
 		inline static void set_timeout(int timeout) noexcept
 		{
 			_timeout = timeout;
 		}
 
-		http_service(const http_service& other);
-		http_service(http_service&& other) noexcept;
-
-		http_service& operator=(const http_service& other);
-		http_service& operator=(http_service&& other) noexcept;
-
 		virtual http_response send(const http_request& request) const;
+		virtual std::future<http_response> send_async(const http_request& request) const;
 	};
 }
\ No newline at end of file
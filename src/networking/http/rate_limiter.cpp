@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <charconv>
+
+#include "rate_limiter.h"
+
+namespace
+{
+	using namespace mb;
+
+	constexpr int TOO_MANY_REQUESTS = 429;
+	constexpr int IP_BANNED = 418;
+	constexpr std::chrono::seconds DEFAULT_RETRY_AFTER{ 1 };
+
+	// Rate limit errors are short, so there is no need to scan the whole of a large response
+	constexpr size_t ERROR_SEARCH_LENGTH = 128;
+
+	std::optional<int> parse_header_int(const http_response& response, std::string_view key)
+	{
+		std::optional<std::string_view> value{ response.header(key) };
+
+		if (!value)
+		{
+			return std::nullopt;
+		}
+
+		int result;
+		auto [ptr, error] = std::from_chars(value->data(), value->data() + value->size(), result);
+
+		if (error != std::errc{})
+		{
+			return std::nullopt;
+		}
+
+		return result;
+	}
+}
+
+namespace mb
+{
+	rate_limiter::rate_limiter(rate_limit limit)
+		:
+		_limit{ std::move(limit) },
+		_orderReserve{ _limit.capacity * 0.1 },
+		_tokens{ _limit.capacity },
+		_lastRefill{ clock::now() },
+		_blockedUntil{},
+		_waitingOrders{ 0 },
+		_mutex{},
+		_condition{}
+	{}
+
+	void rate_limiter::refill(clock::time_point now)
+	{
+		std::chrono::duration<double> elapsed{ now - _lastRefill };
+		_tokens = std::min(_limit.capacity, _tokens + elapsed.count() * _limit.refillPerSecond);
+		_lastRefill = now;
+	}
+
+	double rate_limiter::available(request_priority priority) const
+	{
+		return priority == request_priority::ORDER
+			? _tokens
+			: _tokens - _orderReserve;
+	}
+
+	rate_limiter::clock::duration rate_limiter::time_until_available(double weight, request_priority priority, clock::time_point now) const
+	{
+		if (now < _blockedUntil)
+		{
+			return _blockedUntil - now;
+		}
+
+		double shortfall = std::max(0.0, weight - available(priority));
+
+		if (_limit.refillPerSecond <= 0)
+		{
+			return DEFAULT_RETRY_AFTER;
+		}
+
+		return std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>{ shortfall / _limit.refillPerSecond });
+	}
+
+	void rate_limiter::acquire(double weight, request_priority priority)
+	{
+		std::unique_lock<std::mutex> lock{ _mutex };
+
+		// A request heavier than the whole bucket could never be sent, so let it drain the bucket instead
+		double maxWeight = priority == request_priority::ORDER
+			? _limit.capacity
+			: _limit.capacity - _orderReserve;
+
+		weight = std::min(weight, maxWeight);
+
+		if (priority == request_priority::ORDER)
+		{
+			++_waitingOrders;
+		}
+
+		while (true)
+		{
+			clock::time_point now{ clock::now() };
+			refill(now);
+
+			bool yieldToOrders = priority == request_priority::NORMAL && _waitingOrders > 0;
+
+			if (!yieldToOrders && now >= _blockedUntil && available(priority) >= weight)
+			{
+				_tokens -= weight;
+				break;
+			}
+
+			if (yieldToOrders)
+			{
+				_condition.wait(lock);
+			}
+			else
+			{
+				_condition.wait_for(lock, time_until_available(weight, priority, now));
+			}
+		}
+
+		if (priority == request_priority::ORDER && --_waitingOrders == 0)
+		{
+			_condition.notify_all();
+		}
+	}
+
+	bool rate_limiter::try_acquire(double weight, request_priority priority)
+	{
+		std::lock_guard<std::mutex> lock{ _mutex };
+
+		clock::time_point now{ clock::now() };
+		refill(now);
+
+		if (now < _blockedUntil || available(priority) < weight)
+		{
+			return false;
+		}
+
+		if (priority == request_priority::NORMAL && _waitingOrders > 0)
+		{
+			return false;
+		}
+
+		_tokens -= weight;
+		return true;
+	}
+
+	bool rate_limiter::record_response(const http_response& response)
+	{
+		int code = response.response_code();
+
+		if (code == TOO_MANY_REQUESTS || code == IP_BANNED)
+		{
+			std::optional<int> retryAfter{ parse_header_int(response, "Retry-After") };
+
+			block_for(retryAfter
+				? std::chrono::seconds{ *retryAfter }
+				: DEFAULT_RETRY_AFTER);
+
+			return true;
+		}
+
+		if (!_limit.limitExceededError.empty())
+		{
+			std::string_view message{ response.body() };
+
+			if (message.substr(0, ERROR_SEARCH_LENGTH).find(_limit.limitExceededError) != std::string_view::npos)
+			{
+				block_for(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::duration<double>{ 1.0 / std::max(_limit.refillPerSecond, 1e-3) }));
+				return true;
+			}
+		}
+
+		if (!_limit.usedWeightHeader.empty())
+		{
+			std::optional<int> usedWeight{ parse_header_int(response, _limit.usedWeightHeader) };
+
+			if (usedWeight)
+			{
+				// The exchange's count is authoritative when it has seen more traffic than we have
+				std::lock_guard<std::mutex> lock{ _mutex };
+				refill(clock::now());
+				_tokens = std::min(_tokens, _limit.capacity - *usedWeight);
+			}
+		}
+
+		return false;
+	}
+
+	void rate_limiter::block_for(std::chrono::milliseconds duration)
+	{
+		std::lock_guard<std::mutex> lock{ _mutex };
+
+		_tokens = 0;
+		_lastRefill = clock::now();
+		_blockedUntil = std::max(_blockedUntil, _lastRefill + duration);
+	}
+
+	double rate_limiter::remaining()
+	{
+		std::lock_guard<std::mutex> lock{ _mutex };
+		refill(clock::now());
+
+		return _tokens;
+	}
+}
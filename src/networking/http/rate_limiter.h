@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+
+#include "http_response.h"
+
+namespace mb
+{
+	enum class request_priority
+	{
+		NORMAL,
+		ORDER
+	};
+
+	struct rate_limit
+	{
+		// Burst size and sustained rate of the exchange's counter, in request weight
+		double capacity;
+		double refillPerSecond;
+
+		// Header carrying the weight the exchange has already counted against us, if it sends one
+		std::string usedWeightHeader = "";
+
+		// Error text an exchange returns in a 200 response when the limit is exceeded
+		std::string limitExceededError = "";
+	};
+
+	// Token bucket in front of one exchange rate limit. A slice of the bucket is held back for
+	// order requests, and normal requests queue behind any order that is waiting for budget
+	class rate_limiter
+	{
+	private:
+		using clock = std::chrono::steady_clock;
+
+		rate_limit _limit;
+		double _orderReserve;
+		double _tokens;
+		clock::time_point _lastRefill;
+		clock::time_point _blockedUntil;
+		int _waitingOrders;
+		std::mutex _mutex;
+		std::condition_variable _condition;
+
+		void refill(clock::time_point now);
+		double available(request_priority priority) const;
+		clock::duration time_until_available(double weight, request_priority priority, clock::time_point now) const;
+		void block_for(std::chrono::milliseconds duration);
+
+	public:
+		explicit rate_limiter(rate_limit limit);
+
+		void acquire(double weight = 1, request_priority priority = request_priority::NORMAL);
+		bool try_acquire(double weight = 1, request_priority priority = request_priority::NORMAL);
+		// Returns true if the response shows the exchange's limit was exceeded
+		bool record_response(const http_response& response);
+
+		double remaining();
+	};
+}
@@ -0,0 +1,66 @@
+#include "response_buffer_pool.h"
+
+namespace mb
+{
+	response_buffer_pool::response_buffer_pool()
+		: _idleBuffers{ std::make_shared<idle_buffers>() }
+	{}
+
+	response_buffer_pool& response_buffer_pool::instance()
+	{
+		static response_buffer_pool pool;
+		return pool;
+	}
+
+	std::shared_ptr<std::string> response_buffer_pool::acquire()
+	{
+		std::unique_ptr<std::string> buffer;
+
+		{
+			std::lock_guard<std::mutex> lock{ _idleBuffers->mutex };
+
+			if (!_idleBuffers->buffers.empty())
+			{
+				buffer = std::move(_idleBuffers->buffers.back());
+				_idleBuffers->buffers.pop_back();
+			}
+		}
+
+		if (!buffer)
+		{
+			buffer = std::make_unique<std::string>();
+		}
+
+		return std::shared_ptr<std::string>{ buffer.release(), [idleBuffers = std::weak_ptr<idle_buffers>{ _idleBuffers }](std::string* released)
+			{
+				release(idleBuffers, released);
+			} };
+	}
+
+	void response_buffer_pool::release(const std::weak_ptr<idle_buffers>& idleBuffers, std::string* buffer)
+	{
+		std::unique_ptr<std::string> owned{ buffer };
+		std::shared_ptr<idle_buffers> pool{ idleBuffers.lock() };
+
+		// One unusually large response shouldn't pin its memory for the life of the process
+		if (!pool || owned->capacity() > MAX_RETAINED_CAPACITY)
+		{
+			return;
+		}
+
+		owned->clear();
+
+		std::lock_guard<std::mutex> lock{ pool->mutex };
+
+		if (pool->buffers.size() < MAX_IDLE_BUFFERS)
+		{
+			pool->buffers.push_back(std::move(owned));
+		}
+	}
+
+	int response_buffer_pool::idle_count()
+	{
+		std::lock_guard<std::mutex> lock{ _idleBuffers->mutex };
+		return _idleBuffers->buffers.size();
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mb
+{
+	// Recycles response body strings so their capacity is kept between requests. Buffers return
+	// to the pool when the last http_response referencing them is destroyed
+	class response_buffer_pool
+	{
+	private:
+		static constexpr int MAX_IDLE_BUFFERS = 32;
+
+		struct idle_buffers
+		{
+			std::mutex mutex;
+			std::vector<std::unique_ptr<std::string>> buffers;
+		};
+
+		// Responses can outlive the pool at exit, so their buffers hold the idle list weakly and are simply freed
+		// once it has gone
+		std::shared_ptr<idle_buffers> _idleBuffers;
+
+		response_buffer_pool();
+
+		static void release(const std::weak_ptr<idle_buffers>& idleBuffers, std::string* buffer);
+
+	public:
+		// Buffers grown past this are freed rather than kept for reuse
+		static constexpr size_t MAX_RETAINED_CAPACITY = 16 * 1024 * 1024;
+
+		response_buffer_pool(const response_buffer_pool&) = delete;
+		response_buffer_pool(response_buffer_pool&&) noexcept = delete;
+		response_buffer_pool& operator=(const response_buffer_pool&) = delete;
+		response_buffer_pool& operator=(response_buffer_pool&&) noexcept = delete;
+
+		static response_buffer_pool& instance();
+
+		std::shared_ptr<std::string> acquire();
+		int idle_count();
+	};
+}
@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#include "retry_policy.h"
+#include "http_error.h"
+#include "logging/logger.h"
+
+namespace
+{
+	using namespace mb;
+
+	constexpr int TOO_MANY_REQUESTS = 429;
+	constexpr int FIRST_SERVER_ERROR = 500;
+	constexpr std::chrono::milliseconds HEDGE_POLL_INTERVAL{ 1 };
+
+	std::chrono::milliseconds retry_after(const http_response& response)
+	{
+		std::optional<std::string_view> value{ response.header("Retry-After") };
+
+		if (!value)
+		{
+			return std::chrono::milliseconds{ 0 };
+		}
+
+		try
+		{
+			return std::chrono::seconds{ std::stoi(std::string{ *value }) };
+		}
+		catch (const std::exception&)
+		{
+			return std::chrono::milliseconds{ 0 };
+		}
+	}
+}
+
+namespace mb
+{
+	request_error classify_response(const http_response& response)
+	{
+		int code = response.response_code();
+
+		if (code == HttpResponseCodes::OK)
+		{
+			return request_error::NONE;
+		}
+
+		if (code == TOO_MANY_REQUESTS)
+		{
+			return request_error::RATE_LIMITED;
+		}
+
+		// Gateway errors and timeouts in front of the exchange are as transient as a dropped connection
+		if (code >= FIRST_SERVER_ERROR)
+		{
+			return request_error::NETWORK;
+		}
+
+		return request_error::EXCHANGE_REJECTED;
+	}
+
+	retry_policy::retry_policy(retry_settings settings)
+		:
+		_settings{ std::move(settings) },
+		_endpointDeadlines{},
+		_latencies{},
+		_randomMutex{},
+		_random{ std::random_device{}() }
+	{}
+
+	void retry_policy::set_deadline(std::string endpoint, std::chrono::milliseconds deadline)
+	{
+		_endpointDeadlines.emplace_back(std::move(endpoint), deadline);
+	}
+
+	std::chrono::milliseconds retry_policy::deadline(std::string_view url) const
+	{
+		for (auto& [endpoint, deadline] : _endpointDeadlines)
+		{
+			if (url.find(endpoint) != std::string_view::npos)
+			{
+				return deadline;
+			}
+		}
+
+		return _settings.deadline;
+	}
+
+	std::chrono::milliseconds retry_policy::backoff(int attempt) const
+	{
+		double ceiling{ std::min(
+			static_cast<double>(_settings.maxBackoff.count()),
+			_settings.initialBackoff.count() * std::pow(_settings.backoffMultiplier, attempt)) };
+
+		// Full jitter, so clients that failed together do not all retry together
+		std::uniform_real_distribution<double> distribution{ 0.0, ceiling };
+
+		std::lock_guard<std::mutex> lock{ _randomMutex };
+		return std::chrono::milliseconds{ static_cast<long long>(distribution(_random)) };
+	}
+
+	std::optional<std::chrono::microseconds> retry_policy::hedge_delay(const http_request& request) const
+	{
+		if (!_hedgingEnabled || request.verb() != http_verb::GET || _latencies.sample_count() < _settings.hedgeMinSamples)
+		{
+			return std::nullopt;
+		}
+
+		return _latencies.percentile(_settings.hedgePercentile);
+	}
+
+	http_response retry_policy::send_hedged(const http_service& httpService, const http_request& request, rate_limiter& rateLimiter, double weight, std::chrono::microseconds delay)
+	{
+		std::future<http_response> first{ httpService.send_async(request) };
+
+		// The second copy is only sent if the rate limit has room for it right now
+		if (first.wait_for(delay) == std::future_status::ready || !rateLimiter.try_acquire(weight))
+		{
+			return first.get();
+		}
+
+		std::future<http_response> second{ httpService.send_async(request) };
+
+		while (true)
+		{
+			if (first.wait_for(HEDGE_POLL_INTERVAL) == std::future_status::ready)
+			{
+				return first.get();
+			}
+
+			if (second.wait_for(std::chrono::milliseconds{ 0 }) == std::future_status::ready)
+			{
+				return second.get();
+			}
+		}
+	}
+
+	http_response retry_policy::send_attempt(const http_service& httpService, const http_request& request, rate_limiter& rateLimiter, double weight)
+	{
+		rateLimiter.acquire(weight);
+
+		auto start = std::chrono::steady_clock::now();
+		std::optional<std::chrono::microseconds> hedgeDelay{ hedge_delay(request) };
+
+		http_response response{ hedgeDelay
+			? send_hedged(httpService, request, rateLimiter, weight, *hedgeDelay)
+			: httpService.send(request) };
+
+		_latencies.record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+		return response;
+	}
+
+	http_response retry_policy::run(const http_service& httpService, const http_request& request, rate_limiter& rateLimiter, double weight, const std::function<http_response()>& firstAttempt)
+	{
+		auto deadline = std::chrono::steady_clock::now() + this->deadline(request.url());
+
+		for (int attempt = 0; ; ++attempt)
+		{
+			std::optional<http_response> response;
+			std::exception_ptr networkError;
+			request_error error;
+			std::string errorMessage;
+
+			try
+			{
+				response = attempt == 0
+					? firstAttempt()
+					: send_attempt(httpService, request, rateLimiter, weight);
+
+				error = rateLimiter.record_response(*response)
+					? request_error::RATE_LIMITED
+					: classify_response(*response);
+
+				errorMessage = "response code " + std::to_string(response->response_code());
+			}
+			catch (const http_error& httpError)
+			{
+				networkError = std::current_exception();
+				error = request_error::NETWORK;
+				errorMessage = httpError.what();
+			}
+
+			if (!is_retryable(error))
+			{
+				return std::move(*response);
+			}
+
+			std::chrono::milliseconds delay{ backoff(attempt) };
+			std::chrono::milliseconds expectedWait{ response ? std::max(delay, retry_after(*response)) : delay };
+
+			if (attempt + 1 >= _settings.maxAttempts || std::chrono::steady_clock::now() + expectedWait >= deadline)
+			{
+				if (networkError)
+				{
+					std::rethrow_exception(networkError);
+				}
+
+				return std::move(*response);
+			}
+
+			logger::instance().warning("Request to {0} failed with {1}, retrying attempt {2}/{3} in {4}ms", request.url(), errorMessage, attempt + 1, _settings.maxAttempts - 1, expectedWait.count());
+			std::this_thread::sleep_for(expectedWait);
+		}
+	}
+
+	http_response retry_policy::send(const http_service& httpService, const http_request& request, rate_limiter& rateLimiter, double weight)
+	{
+		return run(httpService, request, rateLimiter, weight, [&]() { return send_attempt(httpService, request, rateLimiter, weight); });
+	}
+
+	http_response retry_policy::complete(std::future<http_response> pending, const http_service& httpService, const http_request& request, rate_limiter& rateLimiter, double weight)
+	{
+		return run(httpService, request, rateLimiter, weight, [&pending]() { return pending.get(); });
+	}
+}
\ No newline at end of file
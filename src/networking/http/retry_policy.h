@@ -0,0 +1,84 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "http_service.h"
+#include "rate_limiter.h"
+#include "common/types/latency_histogram.h"
+
+namespace mb
+{
+	enum class request_error
+	{
+		NONE,
+		NETWORK,
+		RATE_LIMITED,
+		EXCHANGE_REJECTED
+	};
+
+	// Network failures and rate limit responses are worth another attempt, a rejection by the exchange is not
+	constexpr bool is_retryable(request_error error)
+	{
+		return error == request_error::NETWORK || error == request_error::RATE_LIMITED;
+	}
+
+	request_error classify_response(const http_response& response);
+
+	struct retry_settings
+	{
+		int maxAttempts = 3;
+		std::chrono::milliseconds initialBackoff{ 100 };
+		std::chrono::milliseconds maxBackoff{ 2000 };
+		double backoffMultiplier = 2.0;
+
+		// No attempt is started once this much time has passed since the first one
+		std::chrono::milliseconds deadline{ 10000 };
+
+		// A GET that has not answered by this latency percentile is sent a second time and the first response wins
+		double hedgePercentile = 95.0;
+		int hedgeMinSamples = 20;
+	};
+
+	// Re-sends idempotent requests that fail for transient reasons, waiting an exponentially growing,
+	// fully jittered delay between attempts. Requests whose signature includes a nonce must not go through it
+	class retry_policy
+	{
+	private:
+		inline static bool _hedgingEnabled;
+
+		retry_settings _settings;
+		std::vector<std::pair<std::string, std::chrono::milliseconds>> _endpointDeadlines;
+		latency_histogram _latencies;
+		mutable std::mutex _randomMutex;
+		mutable std::mt19937 _random;
+
+		std::optional<std::chrono::microseconds> hedge_delay(const http_request& request) const;
+		http_response send_attempt(const http_service& httpService, const http_request& request, rate_limiter& rateLimiter, double weight);
+		http_response send_hedged(const http_service& httpService, const http_request& request, rate_limiter& rateLimiter, double weight, std::chrono::microseconds delay);
+		http_response run(const http_service& httpService, const http_request& request, rate_limiter& rateLimiter, double weight, const std::function<http_response()>& firstAttempt);
+
+	public:
+		explicit retry_policy(retry_settings settings = {});
+
+		inline static void set_hedging_enabled(bool enabled) noexcept
+		{
+			_hedgingEnabled = enabled;
+		}
+
+		// Requests whose URL contains the endpoint use this deadline instead of the default
+		void set_deadline(std::string endpoint, std::chrono::milliseconds deadline);
+		std::chrono::milliseconds deadline(std::string_view url) const;
+		std::chrono::milliseconds backoff(int attempt) const;
+
+		http_response send(const http_service& httpService, const http_request& request, rate_limiter& rateLimiter, double weight = 1);
+
+		// Takes over a request that was already sent asynchronously, retrying it if the first response is transient
+		http_response complete(std::future<http_response> pending, const http_service& httpService, const http_request& request, rate_limiter& rateLimiter, double weight = 1);
+	};
+}
\ No newline at end of file
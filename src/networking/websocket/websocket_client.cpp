@@ -1,4 +1,5 @@
 #include <memory>
+#include <charconv>
 #include <fmt/format.h>
 
 #include "websocket_client.h"
@@ -27,25 +28,41 @@ namespace
 
         return context;
     }
+
+    long long steady_time_microseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
 }
 
 namespace mb
 {
     websocket_client::websocket_client()
-        :_client{}, _thread{}
+        :_client{}, _deflateClient{}, _thread{}
     {
         _client.clear_access_channels(websocketpp::log::alevel::all);
         _client.clear_error_channels(websocketpp::log::elevel::all);
         _client.init_asio();
         _client.start_perpetual();
         _client.set_tls_init_handler(bind(&on_tls_init));
+
+        _deflateClient.clear_access_channels(websocketpp::log::alevel::all);
+        _deflateClient.clear_error_channels(websocketpp::log::elevel::all);
+        _deflateClient.init_asio(&_client.get_io_service());
+        _deflateClient.set_tls_init_handler(bind(&on_tls_init));
         
         _thread = std::make_unique<std::thread>(&client::run, &_client);
     }
 
     websocket_client::~websocket_client()
     {
+        // Connections still open on either endpoint would keep the shared io service running, so both are stopped
+        // outright rather than left to finish
         _client.stop_perpetual();
+        _deflateClient.stop_perpetual();
+        _client.stop();
+        _deflateClient.stop();
+
         _thread->join();
     }
 
@@ -55,77 +72,48 @@ namespace mb
         return client;
     }
 
-    void websocket_client::connect(client::connection_ptr connectionPtr)
-    {
-        try
-        {
-            _client.connect(connectionPtr);
-
-            volatile bool connecting = true;
-            while (connecting)
-            {
-                connecting = connectionPtr->get_state() == websocketpp::session::state::connecting;
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
-            }
-        }
-        catch (const std::exception& e)
-        {
-            throw websocket_error{ e.what() };
-        }
-
-        if (connectionPtr->get_state() != websocketpp::session::state::open)
-        {
-            throw websocket_error{ fmt::format("Connection Failed. Reason: {}", connectionPtr->get_ec().message()) };
-        }
-    }
-
     void websocket_client::set_open_handshake_timeout(int timeout)
     {
         _client.set_open_handshake_timeout(timeout);
+        _deflateClient.set_open_handshake_timeout(timeout);
     }
 
-    void websocket_client::close_connection(websocketpp::connection_hdl connectionHandle)
+    void websocket_client::close_connection(websocketpp::connection_hdl connectionHandle, bool compressed)
     {
         if (connectionHandle.expired())
         {
             return;
         }
 
-        std::error_code errorCode;
-        auto connectionPtr = _client.get_con_from_hdl(connectionHandle, errorCode);
-        if (!connectionPtr)
+        with_endpoint(compressed, [&](auto& endpoint)
         {
-            return;
-        }
+            std::error_code errorCode;
+            auto connectionPtr = endpoint.get_con_from_hdl(connectionHandle, errorCode);
+            if (!connectionPtr)
+            {
+                return;
+            }
 
-        connectionPtr->close(websocketpp::close::status::normal, "", errorCode);
+            connectionPtr->close(websocketpp::close::status::normal, "", errorCode);
 
-        if (errorCode)
-        {
-            throw websocket_error{ fmt::format("Closing connection: {}", errorCode.message()) };
-        }
+            if (errorCode)
+            {
+                throw websocket_error{ fmt::format("Closing connection: {}", errorCode.message()) };
+            }
 
-        volatile bool closing = true;
-        while (closing)
-        {
-            closing = connectionPtr->get_state() == websocketpp::session::state::closing;
-        }
+            volatile bool closing = true;
+            while (closing)
+            {
+                closing = connectionPtr->get_state() == websocketpp::session::state::closing;
+            }
+        });
     }
 
-    ws_connection_status websocket_client::get_connection_status(websocketpp::connection_hdl connectionHandle)
+    ws_connection_status websocket_client::get_connection_status(websocketpp::connection_hdl connectionHandle, bool compressed)
     {
-        std::error_code errorCode;
-        auto connectionPtr = _client.get_con_from_hdl(connectionHandle, errorCode);
-        
-        if (!connectionPtr || errorCode)
-        {
-            return ws_connection_status::CLOSED;
-        }
-
         using namespace websocketpp::session;
-        state::value state = connectionPtr->get_state();
 
-        switch (state)
+        switch (get_connection_state(connectionHandle, compressed))
         {
         case state::closed:
             return ws_connection_status::CLOSED;
@@ -136,15 +124,53 @@ namespace mb
         }
     }
 
-    void websocket_client::send_message(websocketpp::connection_hdl connectionHandle, std::string_view message)
+    websocketpp::session::state::value websocket_client::get_connection_state(websocketpp::connection_hdl connectionHandle, bool compressed)
+    {
+        using namespace websocketpp::session;
+
+        std::error_code errorCode;
+        return with_endpoint(compressed, [&](auto& endpoint)
+        {
+            auto connectionPtr = endpoint.get_con_from_hdl(connectionHandle, errorCode);
+            return connectionPtr && !errorCode ? connectionPtr->get_state() : state::closed;
+        });
+    }
+
+    void websocket_client::send_message(websocketpp::connection_hdl connectionHandle, bool compressed, std::string_view message)
     {
         std::error_code errorCode;
 
-        _client.send(connectionHandle, message.data(), websocketpp::frame::opcode::text, errorCode);
+        with_endpoint(compressed, [&](auto& endpoint) { endpoint.send(connectionHandle, message.data(), websocketpp::frame::opcode::text, errorCode); });
 
         if (errorCode)
         {
             throw websocket_error{ fmt::format("Sending message: {}", errorCode.message()) };
         }
     }
-}
+
+    void websocket_client::send_ping(websocketpp::connection_hdl connectionHandle, bool compressed)
+    {
+        std::error_code errorCode;
+
+        // The send time is echoed back in the pong payload
+        with_endpoint(compressed, [&](auto& endpoint) { endpoint.ping(connectionHandle, std::to_string(steady_time_microseconds()), errorCode); });
+
+        if (errorCode)
+        {
+            throw websocket_error{ fmt::format("Sending ping: {}", errorCode.message()) };
+        }
+    }
+
+    void websocket_client::record_pong(latency_histogram& roundTripTimes, const std::string& payload)
+    {
+        long long sentTime;
+        auto [end, error] = std::from_chars(payload.data(), payload.data() + payload.size(), sentTime);
+
+        if (error != std::errc{} || end != payload.data() + payload.size())
+        {
+            return;
+        }
+
+        roundTripTimes.record(std::chrono::microseconds{ steady_time_microseconds() - sentTime });
+    }
+}
\ No newline at end of file
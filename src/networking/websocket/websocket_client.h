@@ -3,46 +3,83 @@
 #include <fmt/format.h>
 
 #include <websocketpp/config/asio_client.hpp>
+#include <websocketpp/extensions/permessage_deflate/enabled.hpp>
 #include <websocketpp/client.hpp>
 #include "websocket_error.h"
 #include "websocket_constants.h"
+#include "common/types/latency_histogram.h"
 
 namespace mb
 {
+	struct asio_tls_deflate_client : public websocketpp::config::asio_tls_client
+	{
+		typedef asio_tls_deflate_client type;
+		typedef websocketpp::extensions::permessage_deflate::enabled<permessage_deflate_config> permessage_deflate_type;
+	};
+
 	typedef websocketpp::client<websocketpp::config::asio_tls_client> client;
+	typedef websocketpp::client<asio_tls_deflate_client> deflate_client;
 	typedef websocketpp::lib::asio::ssl::context ssl_context;
 
 	class websocket_client
 	{
 	private:
+		// Both endpoints share one io service. Compressed connections offer permessage-deflate in their handshake
 		client _client;
+		deflate_client _deflateClient;
 		std::unique_ptr<std::thread> _thread;
 
 		websocket_client();
 
-		void connect(client::connection_ptr connectionPtr);
+		static void record_pong(latency_histogram& roundTripTimes, const std::string& payload);
 
-	public:
-		~websocket_client();
+		template<typename Function>
+		decltype(auto) with_endpoint(bool compressed, Function function)
+		{
+			if (compressed)
+			{
+				return function(_deflateClient);
+			}
 
-		websocket_client(const websocket_client&) = delete;
-		websocket_client(websocket_client&&) noexcept = delete;
-		websocket_client& operator=(const websocket_client&) = delete;
-		websocket_client& operator=(websocket_client&&) noexcept = delete;
+			return function(_client);
+		}
 
-		static websocket_client& instance();
+		template<typename Endpoint>
+		void connect(Endpoint& endpoint, typename Endpoint::connection_ptr connectionPtr)
+		{
+			try
+			{
+				endpoint.connect(connectionPtr);
 
-		void set_open_handshake_timeout(int timeout);
+				volatile bool connecting = true;
+				while (connecting)
+				{
+					connecting = connectionPtr->get_state() == websocketpp::session::state::connecting;
+					std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				}
+			}
+			catch (const std::exception& e)
+			{
+				throw websocket_error{ e.what() };
+			}
 
-		template<typename OnOpen, typename OnClose,	typename OnMessage>
-		websocketpp::connection_hdl create_connection(
+			if (connectionPtr->get_state() != websocketpp::session::state::open)
+			{
+				throw websocket_error{ fmt::format("Connection Failed. Reason: {}", connectionPtr->get_ec().message()) };
+			}
+		}
+
+		template<typename Endpoint, typename OnOpen, typename OnClose, typename OnMessage>
+		websocketpp::connection_hdl create_endpoint_connection(
+			Endpoint& endpoint,
 			std::string_view url,
 			OnOpen onOpen,
 			OnClose onClose,
-			OnMessage onMessage)
+			OnMessage onMessage,
+			std::shared_ptr<latency_histogram> roundTripTimes)
 		{
 			std::error_code errorCode;
-			auto connectionPtr = _client.get_connection(url.data(), errorCode);
+			auto connectionPtr = endpoint.get_connection(url.data(), errorCode);
 
 			if (errorCode)
 			{
@@ -62,18 +99,72 @@ namespace mb
 				});
 
 			connectionPtr->set_message_handler(
-				[onMessage](websocketpp::connection_hdl, client::message_ptr message)
+				[onMessage](websocketpp::connection_hdl, typename Endpoint::message_ptr message)
 				{
 					onMessage(message->get_payload());
 				});
 
-			connect(connectionPtr);
+			// Held weakly, so pings stop once the connection's owner has released its round trip times
+			connectionPtr->set_pong_handler(
+				[weakRoundTripTimes = std::weak_ptr<latency_histogram>{ roundTripTimes }](websocketpp::connection_hdl, std::string payload)
+				{
+					if (std::shared_ptr<latency_histogram> roundTripTimes = weakRoundTripTimes.lock())
+					{
+						record_pong(*roundTripTimes, payload);
+					}
+				});
+
+			connect(endpoint, connectionPtr);
 
 			return connectionPtr->get_handle();
 		}
-				
-		void close_connection(websocketpp::connection_hdl connectionHandle);
-		ws_connection_status get_connection_status(websocketpp::connection_hdl connectionHandle);
-		void send_message(websocketpp::connection_hdl connectionHandle, std::string_view message);
+
+	public:
+		~websocket_client();
+
+		websocket_client(const websocket_client&) = delete;
+		websocket_client(websocket_client&&) noexcept = delete;
+		websocket_client& operator=(const websocket_client&) = delete;
+		websocket_client& operator=(websocket_client&&) noexcept = delete;
+
+		static websocket_client& instance();
+
+		void set_open_handshake_timeout(int timeout);
+
+		template<typename OnOpen, typename OnClose,	typename OnMessage>
+		websocketpp::connection_hdl create_connection(
+			std::string_view url,
+			bool compressed,
+			OnOpen onOpen,
+			OnClose onClose,
+			OnMessage onMessage,
+			std::shared_ptr<latency_histogram> roundTripTimes)
+		{
+			return with_endpoint(compressed, [&](auto& endpoint)
+			{
+				return create_endpoint_connection(endpoint, url, std::move(onOpen), std::move(onClose), std::move(onMessage), std::move(roundTripTimes));
+			});
+		}
+
+		void close_connection(websocketpp::connection_hdl connectionHandle, bool compressed);
+		ws_connection_status get_connection_status(websocketpp::connection_hdl connectionHandle, bool compressed);
+
+		// Unlike get_connection_status, reports a connection that is still connecting or closing rather than throwing
+		websocketpp::session::state::value get_connection_state(websocketpp::connection_hdl connectionHandle, bool compressed);
+		void send_message(websocketpp::connection_hdl connectionHandle, bool compressed, std::string_view message);
+		void send_ping(websocketpp::connection_hdl connectionHandle, bool compressed);
+
+		template<typename Handler>
+		void schedule(std::chrono::milliseconds delay, Handler handler)
+		{
+			_client.set_timer(static_cast<long>(delay.count()),
+				[handler](const auto& errorCode)
+				{
+					if (!errorCode)
+					{
+						handler();
+					}
+				});
+		}
 	};
 }
\ No newline at end of file
@@ -1,31 +1,85 @@
 #include "websocket_connection.h"
 
+namespace
+{
+    using namespace mb;
+
+    void schedule_ping(websocket_client& client, websocketpp::connection_hdl connectionHandle, bool compressed, std::weak_ptr<latency_histogram> roundTripTimes, int interval)
+    {
+        client.schedule(std::chrono::milliseconds{ interval }, [&client, connectionHandle, compressed, roundTripTimes, interval]()
+        {
+            using namespace websocketpp::session;
+
+            state::value connectionState{ client.get_connection_state(connectionHandle, compressed) };
+
+            if (roundTripTimes.expired() || connectionState == state::closed)
+            {
+                return;
+            }
+
+            // A connection that is still opening is pinged at a later interval
+            if (connectionState == state::open)
+            {
+                try
+                {
+                    client.send_ping(connectionHandle, compressed);
+                }
+                catch (const websocket_error&)
+                {
+                    // The connection has started closing, the next interval sees it closed
+                }
+            }
+
+            schedule_ping(client, connectionHandle, compressed, roundTripTimes, interval);
+        });
+    }
+}
+
 namespace mb
 {
-    websocket_connection::websocket_connection(websocketpp::connection_hdl connectionHandle)
+    websocket_connection::websocket_connection(websocketpp::connection_hdl connectionHandle, bool compressed, std::shared_ptr<latency_histogram> roundTripTimes)
         : 
         _client{ websocket_client::instance() }, 
-        _connectionHandle{ connectionHandle }
+        _connectionHandle{ connectionHandle },
+        _compressed{ compressed },
+        _roundTripTimes{ std::move(roundTripTimes) }
     {}
 
     void websocket_connection::close()
     {
-        _client.close_connection(_connectionHandle);
+        _client.close_connection(_connectionHandle, _compressed);
     }
 
     void websocket_connection::send_message(std::string message)
     {
-        _client.send_message(_connectionHandle, message);
+        _client.send_message(_connectionHandle, _compressed, message);
     }
 
     ws_connection_status websocket_connection::connection_status() const
     {
-        return _client.get_connection_status(_connectionHandle);
+        return _client.get_connection_status(_connectionHandle, _compressed);
+    }
+
+    latency_summary websocket_connection::round_trip_times() const
+    {
+        return _roundTripTimes->summarise();
+    }
+
+    void websocket_connection::start_pinging()
+    {
+        if (_pingInterval > 0)
+        {
+            schedule_ping(_client, _connectionHandle, _compressed, _roundTripTimes, _pingInterval);
+        }
     }
 
     std::unique_ptr<websocket_connection> websocket_connection_factory::create_connection(std::string url) const
     {
-        auto handle =  websocket_client::instance().create_connection(url, _onOpen, _onClose, _onMessage);
-        return std::make_unique<websocket_connection>(handle);
+        auto roundTripTimes = std::make_shared<latency_histogram>();
+        auto handle =  websocket_client::instance().create_connection(url, _compression, _onOpen, _onClose, _onMessage, roundTripTimes);
+
+        auto connection = std::make_unique<websocket_connection>(handle, _compression, std::move(roundTripTimes));
+        connection->start_pinging();
+        return connection;
     }
 }
\ No newline at end of file
@@ -11,11 +11,18 @@ namespace mb
     class websocket_connection
     {
     private:
+        inline static int _pingInterval = 10000;
+
         websocket_client& _client;
         websocketpp::connection_hdl _connectionHandle;
+        bool _compressed;
+        std::shared_ptr<latency_histogram> _roundTripTimes;
 
     public:
-        websocket_connection(websocketpp::connection_hdl connectionHandle);
+        websocket_connection(
+            websocketpp::connection_hdl connectionHandle,
+            bool compressed = false,
+            std::shared_ptr<latency_histogram> roundTripTimes = std::make_shared<latency_histogram>());
 
         virtual ~websocket_connection()
         {
@@ -28,9 +35,19 @@ namespace mb
         websocket_connection& operator=(const websocket_connection&) = delete;
         websocket_connection& operator=(websocket_connection&&) noexcept = default;
 
+        inline static void set_ping_interval(int milliseconds) noexcept
+        {
+            _pingInterval = milliseconds;
+        }
+
         virtual ws_connection_status connection_status() const;
         virtual void close();
         virtual void send_message(std::string message);
+        virtual latency_summary round_trip_times() const;
+
+        bool compressed() const noexcept { return _compressed; }
+
+        void start_pinging();
     };
 
     class websocket_connection_factory
@@ -43,8 +60,13 @@ namespace mb
         on_open _onOpen;
         on_close _onClose;
         on_message _onMessage;
+        bool _compression;
 
     public:
+        explicit websocket_connection_factory(bool compression = false)
+            : _compression{ compression }
+        {}
+
         virtual ~websocket_connection_factory() = default;
 
         void set_on_open(on_open onOpen) noexcept { _onOpen = std::move(onOpen); }
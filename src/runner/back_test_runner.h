@@ -14,6 +14,56 @@
 
 namespace mb::internal
 {
+	// Strategies run at every step unless they declare static constexpr time_advance TIME_ADVANCE = time_advance::EVENT,
+	// in which case they only run when a pair has new data
+	template<typename Strategy, typename = void>
+	struct strategy_time_advance
+	{
+		static constexpr time_advance value = time_advance::STEP;
+	};
+
+	template<typename Strategy>
+	struct strategy_time_advance<Strategy, std::void_t<decltype(Strategy::TIME_ADVANCE)>>
+	{
+		static constexpr time_advance value = Strategy::TIME_ADVANCE;
+	};
+
+	template<typename RunStep>
+	void run_back_test_steps(back_testing_data& backTestingData, time_advance timeAdvance, RunStep runStep)
+	{
+		if (timeAdvance == time_advance::EVENT)
+		{
+			do
+			{
+				runStep();
+			} while (backTestingData.increment_to_next_event());
+
+			return;
+		}
+
+		int timeSteps{ backTestingData.time_steps() };
+
+		for (int i = 0; i < timeSteps; ++i)
+		{
+			runStep();
+			backTestingData.increment();
+		}
+	}
+
+	// Paper orders walk recorded order books, and fill at the last trade price for pairs without one
+	inline paper_trade_api::get_order_book_function create_order_book_function(std::shared_ptr<back_testing_data> backTestingData)
+	{
+		return [backTestingData](const tradable_pair& pair, int depth) -> std::optional<order_book_state>
+		{
+			if (!backTestingData->has_order_book(pair))
+			{
+				return std::nullopt;
+			}
+
+			return backTestingData->get_order_book(pair, depth);
+		};
+	}
+
 	template<typename Strategy>
 	class back_test_runner : public runner_implementation<Strategy>
 	{
@@ -30,6 +80,8 @@ namespace mb::internal
 
 		std::vector<std::shared_ptr<exchange>> create_exchanges(const runner_config& runnerConfig) override
 		{
+			websocket_stream::set_trade_history_depth(runnerConfig.trade_history_depth());
+
 			_backTestingData = load_back_testing_data(
 				create_data_source(_config.data_directory()),
 				_config);
@@ -39,7 +91,8 @@ namespace mb::internal
 			_paperTradeApi = create_paper_trade_api(
 				exchange_ids::BACK_TEST, 
 				_websocketStream,
-				[this]() { return _backTestingData->data_time(); });
+				[this]() { return _backTestingData->data_time(); },
+				create_order_book_function(_backTestingData));
 
 			return
 			{
@@ -54,12 +107,13 @@ namespace mb::internal
 		void run(Strategy& strategy) override
 		{
 			test_logger testLogger{ mb::create_test_logger({ _paperTradeApi }) };
-			int timeSteps{ _backTestingData->time_steps() };
 			int lastLoggedPercentage = -1;
 
-			for (int i = 0; i < timeSteps; ++i)
+			run_back_test_steps(*_backTestingData, strategy_time_advance<Strategy>::value, [&]()
 			{
-				int percentageComplete = calculate_percentage_proportion(1, timeSteps, i + 1);
+				int percentageComplete = _backTestingData->end_time() == _backTestingData->start_time()
+					? 100
+					: calculate_percentage_proportion(_backTestingData->start_time(), _backTestingData->end_time(), _backTestingData->data_time());
 				
 				if (percentageComplete > lastLoggedPercentage)
 				{
@@ -78,9 +132,7 @@ namespace mb::internal
 				{
 					logger::instance().error(e.what());
 				}
-
-				_backTestingData->increment();
-			}
+			});
 
 			logger::instance().info("Back test complete. Generating report...");
 
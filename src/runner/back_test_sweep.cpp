@@ -0,0 +1,65 @@
+#include "back_test_sweep.h"
+
+namespace mb
+{
+	back_test_sweep::back_test_sweep(
+		std::shared_ptr<back_testing_data> backTestingData,
+		paper_trading_config paperTradingConfig,
+		std::filesystem::path outputDirectory,
+		int threadCount)
+		:
+		_backTestingData{ std::move(backTestingData) },
+		_paperTradingConfig{ std::move(paperTradingConfig) },
+		_outputDirectory{ std::move(outputDirectory) },
+		_threadCount{ threadCount }
+	{}
+
+	void back_test_sweep::log_sweep_summary(const std::vector<sweep_result>& rankedResults) const
+	{
+		static constexpr std::string_view SUMMARY_FILENAME = "sweep_summary.txt";
+
+		std::string summary{ generate_sweep_summary_string(rankedResults) };
+
+		try
+		{
+			std::filesystem::create_directories(_outputDirectory);
+			write_to_file(_outputDirectory / SUMMARY_FILENAME, summary);
+		}
+		catch (const std::exception& e)
+		{
+			logger::instance().error("An error occurred whilst saving the sweep summary: {}", e.what());
+		}
+
+		logger::instance().info("\n" + summary);
+	}
+
+	back_test_sweep create_back_test_sweep(int threadCount)
+	{
+		back_testing_config config{ internal::load_or_create_config<back_testing_config>() };
+
+		if (config.dynamic_load())
+		{
+			logger::instance().warning("Dynamic data loading is not used by sweeps, all data will be loaded up front");
+		}
+
+		back_testing_config sweepConfig
+		{
+			config.start_time(),
+			config.end_time(),
+			config.step_size(),
+			config.data_directory(),
+			false,
+			config.load_threads(),
+			config.dynamic_load_window(),
+			config.dynamic_load_memory_mb()
+		};
+
+		return back_test_sweep
+		{
+			load_back_testing_data(create_data_source(sweepConfig.data_directory()), sweepConfig),
+			internal::load_or_create_config<paper_trading_config>(),
+			get_test_output_path(),
+			threadCount
+		};
+	}
+}
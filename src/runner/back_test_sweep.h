@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <fmt/format.h>
+
+#include "back_test_runner.h"
+#include "testing/reporting/sweep_report.h"
+#include "common/utils/generalutils.h"
+
+namespace mb
+{
+	// Runs many configurations of a strategy concurrently over one copy of the back test data. Each run has its own
+	// cursor, paper trade API and report, written to a numbered folder beneath the sweep's output directory
+	class back_test_sweep
+	{
+	private:
+		std::shared_ptr<back_testing_data> _backTestingData;
+		paper_trading_config _paperTradingConfig;
+		std::filesystem::path _outputDirectory;
+		int _threadCount;
+
+		void log_sweep_summary(const std::vector<sweep_result>& rankedResults) const;
+
+		template<typename CreateStrategy, typename ScoreRun>
+		sweep_result run_once(int run, CreateStrategy& createStrategy, ScoreRun& scoreRun) const
+		{
+			std::shared_ptr<back_testing_data> backTestingData{ _backTestingData->create_cursor() };
+			auto websocketStream = std::make_shared<backtest_websocket_stream>(backTestingData);
+			auto paperTradeApi = std::make_shared<paper_trade_api>(
+				_paperTradingConfig,
+				websocketStream,
+				exchange_ids::BACK_TEST,
+				[backTestingData]() { return backTestingData->data_time(); },
+				internal::create_order_book_function(backTestingData));
+
+			auto strategy = createStrategy(run);
+			strategy->initialise(
+				{
+					std::make_shared<back_test_exchange>(
+						exchange_ids::BACK_TEST,
+						websocketStream,
+						std::make_shared<back_test_market_api>(backTestingData),
+						paperTradeApi)
+				});
+
+			test_logger testLogger{ create_test_logger({ paperTradeApi }, _outputDirectory / fmt::format("run_{}", run)) };
+			using strategy_type = typename decltype(strategy)::element_type;
+
+			internal::run_back_test_steps(*backTestingData, internal::strategy_time_advance<strategy_type>::value, [&]()
+			{
+				websocketStream->notify();
+
+				try
+				{
+					strategy->run_iteration();
+					testLogger.flush_trades();
+				}
+				catch (const mb_exception& e)
+				{
+					logger::instance().error("Run {0}: {1}", run, e.what());
+				}
+			});
+
+			test_report report{ generate_back_test_report(*backTestingData, testLogger, strategy->get_test_results()) };
+			testLogger.log_test_report(report);
+
+			return sweep_result{ run, scoreRun(*strategy, *paperTradeApi), std::move(report) };
+		}
+
+	public:
+		back_test_sweep(
+			std::shared_ptr<back_testing_data> backTestingData,
+			paper_trading_config paperTradingConfig,
+			std::filesystem::path outputDirectory,
+			int threadCount = 0);
+
+		const std::filesystem::path& output_directory() const noexcept { return _outputDirectory; }
+
+		// createStrategy(run) returns a std::unique_ptr to the strategy configured for that run and scoreRun(strategy, tradeApi)
+		// scores it once the run has finished. Results are returned highest score first
+		template<typename CreateStrategy, typename ScoreRun>
+		std::vector<sweep_result> run(int runCount, CreateStrategy createStrategy, ScoreRun scoreRun) const
+		{
+			int threadCount{ resolve_thread_count(_threadCount, runCount) };
+			logger::instance().info("Running {0} back tests on {1} threads", runCount, threadCount);
+
+			std::vector<std::optional<sweep_result>> results(runCount);
+			std::vector<std::exception_ptr> errors(threadCount);
+			std::atomic<int> nextRun{ 0 };
+			std::atomic<int> completedRuns{ 0 };
+
+			auto runWorker = [&](int workerIndex)
+			{
+				try
+				{
+					for (int run = nextRun++; run < runCount; run = nextRun++)
+					{
+						results[run].emplace(run_once(run, createStrategy, scoreRun));
+						logger::instance().info("Sweep {0}/{1} runs complete", ++completedRuns, runCount);
+					}
+				}
+				catch (...)
+				{
+					errors[workerIndex] = std::current_exception();
+					nextRun = runCount;
+				}
+			};
+
+			std::vector<std::thread> workers;
+			workers.reserve(threadCount - 1);
+
+			for (int i = 1; i < threadCount; ++i)
+			{
+				workers.emplace_back(runWorker, i);
+			}
+
+			runWorker(0);
+
+			for (auto& worker : workers)
+			{
+				worker.join();
+			}
+
+			for (auto& error : errors)
+			{
+				if (error)
+				{
+					std::rethrow_exception(error);
+				}
+			}
+
+			std::vector<sweep_result> rankedResults;
+			rankedResults.reserve(runCount);
+
+			for (auto& result : results)
+			{
+				rankedResults.emplace_back(std::move(*result));
+			}
+
+			rank_sweep_results(rankedResults);
+			log_sweep_summary(rankedResults);
+
+			return rankedResults;
+		}
+	};
+
+	// Loads all of the configured back test data up front so that it can be shared by every run
+	back_test_sweep create_back_test_sweep(int threadCount = 0);
+}
@@ -1,7 +1,13 @@
+#include <algorithm>
+
 #include "exchange_factory.h"
 #include "networking/http/http_service.h"
+#include "networking/http/retry_policy.h"
 #include "logging/logger.h"
 #include "exchanges/exchange_ids.h"
+#include "exchanges/cached_exchange.h"
+#include "common/file/local_directory.h"
+#include "exchanges/websockets/exchange_websocket_stream.h"
 #include "exchanges/kraken/kraken.h"
 #include "exchanges/coinbase/coinbase.h"
 #include "exchanges/bybit/bybit.h"
@@ -12,34 +18,34 @@ namespace
 {
 	using namespace mb;
 
-	std::unique_ptr<exchange> create_api_from_id(std::string_view identifier)
+	std::unique_ptr<exchange> create_api_from_id(std::string_view identifier, bool websocketCompression)
 	{
 		if (identifier == exchange_ids::KRAKEN)
 		{
-			return create_exchange_api<kraken_api>();
+			return create_exchange_api<kraken_api>(false, websocketCompression);
 		}
 		if (identifier == exchange_ids::COINBASE)
 		{
-			return create_exchange_api<coinbase_api>();
+			return create_exchange_api<coinbase_api>(false, websocketCompression);
 		}
 		if (identifier == exchange_ids::BYBIT)
 		{
-			return create_exchange_api<bybit_api>();
+			return create_exchange_api<bybit_api>(false, websocketCompression);
 		}
 		if (identifier == exchange_ids::DIGIFINEX)
 		{
-			return create_exchange_api<digifinex_api>();
+			return create_exchange_api<digifinex_api>(false, websocketCompression);
 		}
 		if (identifier == exchange_ids::BINANCE)
 		{
-			return create_exchange_api<binance_api>();
+			return create_exchange_api<binance_api>(false, websocketCompression);
 		}
 
 		return nullptr;
 	}
 
 	template<typename ExchangeIds>
-	std::vector<std::shared_ptr<exchange>> create_exchanges(const ExchangeIds& exchangeIds)
+	std::vector<std::shared_ptr<exchange>> create_exchanges(const ExchangeIds& exchangeIds, const runner_config& runnerConfig)
 	{
 		std::vector<std::shared_ptr<exchange>> exchanges;
 		exchanges.reserve(exchangeIds.size());
@@ -50,7 +56,9 @@ namespace
 		{
 			log.info("Creating exchange API: {}", exchangeId);
 
-			std::unique_ptr<exchange> api = create_api_from_id(exchangeId);
+			const std::vector<std::string>& compressedIds{ runnerConfig.websocket_compression() };
+			bool websocketCompression{ std::find(compressedIds.begin(), compressedIds.end(), exchangeId) != compressedIds.end() };
+			std::unique_ptr<exchange> api = create_api_from_id(exchangeId, websocketCompression);
 
 			if (!api)
 			{
@@ -58,6 +66,11 @@ namespace
 				continue;
 			}
 
+			if (runnerConfig.cache_responses())
+			{
+				api = std::make_unique<cached_exchange>(std::move(api), get_local_directory() / "cache");
+			}
+
 			log.info("{} API created successfully. Testing connection...", exchangeId);
 
 			exchange_status status = api->get_status();
@@ -85,16 +98,19 @@ namespace mb::internal
 	{
 		http_service::set_timeout(runnerConfig.http_timeout());
 		websocket_client::instance().set_open_handshake_timeout(runnerConfig.websocket_timeout());
+		websocket_connection::set_ping_interval(runnerConfig.websocket_ping_interval());
+		websocket_stream::set_trade_history_depth(runnerConfig.trade_history_depth());
+		retry_policy::set_hedging_enabled(runnerConfig.hedge_requests());
 
 		logger::instance().info("Creating exchange APIs...");
 
 		if (runnerConfig.exchange_ids().empty())
 		{
-			return ::create_exchanges(exchange_ids::all());
+			return ::create_exchanges(exchange_ids::all(), runnerConfig);
 		}
 		else
 		{
-			return ::create_exchanges(runnerConfig.exchange_ids());
+			return ::create_exchanges(runnerConfig.exchange_ids(), runnerConfig);
 		}
 	}
 }
\ No newline at end of file
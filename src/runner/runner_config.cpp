@@ -8,6 +8,8 @@ namespace
 
 	static constexpr int DEFAULT_WEBSOCKET_TIMEOUT = 5000;
 	static constexpr int DEFAULT_HTTP_TIMEOUT = 5000;
+	static constexpr int DEFAULT_TRADE_HISTORY_DEPTH = 100;
+	static constexpr int DEFAULT_WEBSOCKET_PING_INTERVAL = 10000;
 
 	namespace json_property_names
 	{
@@ -17,6 +19,11 @@ namespace
 		static constexpr std::string_view HTTP_TIMEOUT = "httpTimeout";
 		static constexpr std::string_view RUN_INTERVAL = "runInterval";
 		static constexpr std::string_view SYNC_TIME = "syncTime";
+		static constexpr std::string_view TRADE_HISTORY_DEPTH = "tradeHistoryDepth";
+		static constexpr std::string_view WEBSOCKET_PING_INTERVAL = "websocketPingInterval";
+		static constexpr std::string_view WEBSOCKET_COMPRESSION = "websocketCompression";
+		static constexpr std::string_view CACHE_RESPONSES = "cacheResponses";
+		static constexpr std::string_view HEDGE_REQUESTS = "hedgeRequests";
 	}
 
 	namespace run_mode_strings
@@ -64,7 +71,7 @@ namespace mb
 	}
 
 	runner_config::runner_config()
-		: runner_config{ {}, run_mode::LIVETEST, DEFAULT_WEBSOCKET_TIMEOUT, DEFAULT_HTTP_TIMEOUT, 0, false }
+		: runner_config{ {}, run_mode::LIVETEST, DEFAULT_WEBSOCKET_TIMEOUT, DEFAULT_HTTP_TIMEOUT, 0, false, DEFAULT_TRADE_HISTORY_DEPTH, DEFAULT_WEBSOCKET_PING_INTERVAL, {}, false, false }
 	{}
 
 	runner_config::runner_config(
@@ -73,14 +80,24 @@ namespace mb
 		int websocketTimeout,
 		int httpTimeout,
 		int runInterval,
-		bool syncTime)
+		bool syncTime,
+		int tradeHistoryDepth,
+		int websocketPingInterval,
+		std::vector<std::string> websocketCompression,
+		bool cacheResponses,
+		bool hedgeRequests)
 		:
 		_exchangeIds{ std::move(exchangeIds) },
 		_runMode{ runMode },
 		_websocketTimeout{ websocketTimeout },
 		_httpTimeout{ httpTimeout },
 		_runInterval{ runInterval },
-		_syncTime{ syncTime }
+		_syncTime{ syncTime },
+		_tradeHistoryDepth{ tradeHistoryDepth },
+		_websocketPingInterval{ websocketPingInterval },
+		_websocketCompression{ std::move(websocketCompression) },
+		_cacheResponses{ cacheResponses },
+		_hedgeRequests{ hedgeRequests }
 	{
 		validate();
 	}
@@ -104,6 +121,18 @@ namespace mb
 			_runInterval = 0;
 			log.warning("Run interval cannot be less than zero");
 		}
+
+		if (_tradeHistoryDepth <= 0)
+		{
+			_tradeHistoryDepth = DEFAULT_TRADE_HISTORY_DEPTH;
+			log.warning("Trade history depth must be greater than zero, using default of {}", DEFAULT_TRADE_HISTORY_DEPTH);
+		}
+
+		if (_websocketPingInterval < 0)
+		{
+			_websocketPingInterval = 0;
+			log.warning("Websocket ping interval cannot be less than zero, pings are disabled");
+		}
 	}
 
 	template<>
@@ -116,7 +145,12 @@ namespace mb
 			json.get<int>(json_property_names::WEBSOCKET_TIMEOUT),
 			json.get<int>(json_property_names::HTTP_TIMEOUT),
 			json.get<int>(json_property_names::RUN_INTERVAL),
-			json.get<bool>(json_property_names::SYNC_TIME)
+			json.get<bool>(json_property_names::SYNC_TIME),
+			json.get_or_default(json_property_names::TRADE_HISTORY_DEPTH, DEFAULT_TRADE_HISTORY_DEPTH),
+			json.get_or_default(json_property_names::WEBSOCKET_PING_INTERVAL, DEFAULT_WEBSOCKET_PING_INTERVAL),
+			json.get_or_default(json_property_names::WEBSOCKET_COMPRESSION, std::vector<std::string>{}),
+			json.get_or_default(json_property_names::CACHE_RESPONSES, false),
+			json.get_or_default(json_property_names::HEDGE_REQUESTS, false)
 		};
 	}
 
@@ -129,5 +163,10 @@ namespace mb
 		writer.add(json_property_names::HTTP_TIMEOUT, config.http_timeout());
 		writer.add(json_property_names::RUN_INTERVAL, config.run_interval());
 		writer.add(json_property_names::SYNC_TIME, config.sync_time());
+		writer.add(json_property_names::TRADE_HISTORY_DEPTH, config.trade_history_depth());
+		writer.add(json_property_names::WEBSOCKET_PING_INTERVAL, config.websocket_ping_interval());
+		writer.add(json_property_names::WEBSOCKET_COMPRESSION, config.websocket_compression());
+		writer.add(json_property_names::CACHE_RESPONSES, config.cache_responses());
+		writer.add(json_property_names::HEDGE_REQUESTS, config.hedge_requests());
 	}
 }
\ No newline at end of file
@@ -23,6 +23,11 @@ namespace mb
 		int _httpTimeout;
 		int _runInterval;
 		bool _syncTime;
+		int _tradeHistoryDepth;
+		int _websocketPingInterval;
+		std::vector<std::string> _websocketCompression;
+		bool _cacheResponses;
+		bool _hedgeRequests;
 
 		void validate();
 
@@ -35,7 +40,12 @@ namespace mb
 			int websocketTimeout,
 			int httpTimeout,
 			int runInterval,
-			bool syncTime);
+			bool syncTime,
+			int tradeHistoryDepth,
+			int websocketPingInterval,
+			std::vector<std::string> websocketCompression,
+			bool cacheResponses,
+			bool hedgeRequests);
 			
 		static std::string name() noexcept { return "runner"; }
 		
@@ -45,6 +55,11 @@ namespace mb
 		constexpr int http_timeout() const noexcept { return _httpTimeout; }
 		constexpr int run_interval() const noexcept { return _runInterval; }
 		constexpr bool sync_time() const noexcept { return _syncTime; }
+		constexpr int trade_history_depth() const noexcept { return _tradeHistoryDepth; }
+		constexpr int websocket_ping_interval() const noexcept { return _websocketPingInterval; }
+		constexpr const std::vector<std::string>& websocket_compression() const noexcept { return _websocketCompression; }
+		constexpr bool cache_responses() const noexcept { return _cacheResponses; }
+		constexpr bool hedge_requests() const noexcept { return _hedgeRequests; }
 	};
 
 	template<>
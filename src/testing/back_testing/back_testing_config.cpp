@@ -9,6 +9,9 @@ namespace
 		static constexpr std::string_view STEP_SIZE = "stepSize";
 		static constexpr std::string_view DATA_DIRECTORY = "dataDirectory";
 		static constexpr std::string_view DYNAMIC_LOAD = "dynamicDataLoad";
+		static constexpr std::string_view LOAD_THREADS = "dataLoadThreads";
+		static constexpr std::string_view DYNAMIC_LOAD_WINDOW = "dynamicDataLoadWindow";
+		static constexpr std::string_view DYNAMIC_LOAD_MEMORY = "dynamicDataLoadMemoryMb";
 	}
 }
 
@@ -20,7 +23,10 @@ namespace mb
 		_endTime{ 0 },
 		_stepSize{ 60 },
 		_dataDirectory{ "back_test_data" },
-		_dynamicLoad{ false }
+		_dynamicLoad{ false },
+		_loadThreads{ 0 },
+		_dynamicLoadWindow{ 0 },
+		_dynamicLoadMemoryMb{ 0 }
 	{}
 
 	back_testing_config::back_testing_config(
@@ -28,13 +34,19 @@ namespace mb
 		std::time_t endTime,
 		int stepSize,
 		std::string dataDirectory,
-		bool dynamicLoad)
+		bool dynamicLoad,
+		int loadThreads,
+		std::time_t dynamicLoadWindow,
+		int dynamicLoadMemoryMb)
 		:
 		_startTime{ startTime },
 		_endTime{ endTime },
 		_stepSize{ stepSize },
 		_dataDirectory{ std::move(dataDirectory) },
-		_dynamicLoad{ dynamicLoad }
+		_dynamicLoad{ dynamicLoad },
+		_loadThreads{ loadThreads },
+		_dynamicLoadWindow{ dynamicLoadWindow },
+		_dynamicLoadMemoryMb{ dynamicLoadMemoryMb }
 	{
 		validate();
 	}
@@ -53,6 +65,9 @@ namespace mb
 		}
 
 		assert_throw(_stepSize > 0, "Step size must be greater than zero");
+		assert_throw(_loadThreads >= 0, "Data load threads cannot be less than zero");
+		assert_throw(_dynamicLoadWindow >= 0, "Dynamic data load window cannot be less than zero");
+		assert_throw(_dynamicLoadMemoryMb >= 0, "Dynamic data load memory cannot be less than zero");
 	}
 
 	template<>
@@ -64,7 +79,10 @@ namespace mb
 			json.get<std::time_t>(json_property_names::END_TIME),
 			json.get<int>(json_property_names::STEP_SIZE),
 			json.get<std::string>(json_property_names::DATA_DIRECTORY),
-			json.get<bool>(json_property_names::DYNAMIC_LOAD)
+			json.get<bool>(json_property_names::DYNAMIC_LOAD),
+			json.get_or_default(json_property_names::LOAD_THREADS, 0),
+			json.get_or_default<std::time_t>(json_property_names::DYNAMIC_LOAD_WINDOW, 0),
+			json.get_or_default(json_property_names::DYNAMIC_LOAD_MEMORY, 0)
 		};
 	}
 
@@ -76,5 +94,8 @@ namespace mb
 		writer.add(json_property_names::STEP_SIZE, config.step_size());
 		writer.add(json_property_names::DATA_DIRECTORY, config.data_directory());
 		writer.add(json_property_names::DYNAMIC_LOAD, config.dynamic_load());
+		writer.add(json_property_names::LOAD_THREADS, config.load_threads());
+		writer.add(json_property_names::DYNAMIC_LOAD_WINDOW, config.dynamic_load_window());
+		writer.add(json_property_names::DYNAMIC_LOAD_MEMORY, config.dynamic_load_memory_mb());
 	}
 }
\ No newline at end of file
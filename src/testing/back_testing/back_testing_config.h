@@ -16,6 +16,9 @@ namespace mb
 		int _stepSize;
 		std::string _dataDirectory;
 		bool _dynamicLoad;
+		int _loadThreads;
+		std::time_t _dynamicLoadWindow;
+		int _dynamicLoadMemoryMb;
 
 		void validate();
 
@@ -27,7 +30,10 @@ namespace mb
 			std::time_t endTime,
 			int stepSize,
 			std::string dataDirectory,
-			bool dynamicLoad);
+			bool dynamicLoad,
+			int loadThreads,
+			std::time_t dynamicLoadWindow,
+			int dynamicLoadMemoryMb);
 
 		static std::string name() noexcept { return "back_testing"; }
 
@@ -36,6 +42,16 @@ namespace mb
 		int step_size() const noexcept { return _stepSize; }
 		const std::string& data_directory() const noexcept { return _dataDirectory; }
 		bool dynamic_load() const noexcept { return _dynamicLoad; }
+
+		// Zero uses one thread per hardware core
+		int load_threads() const noexcept { return _loadThreads; }
+
+		// Seconds of candles kept per pair when loading dynamically, along with the window before for look back.
+		// Zero loads each pair's whole history
+		std::time_t dynamic_load_window() const noexcept { return _dynamicLoadWindow; }
+
+		// Zero places no limit on the memory taken by dynamically loaded windows
+		int dynamic_load_memory_mb() const noexcept { return _dynamicLoadMemoryMb; }
 	};
 
 	template<>
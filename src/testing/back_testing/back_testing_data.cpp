@@ -1,6 +1,8 @@
-#include <optional>
+#include <algorithm>
+#include <functional>
 
 #include "back_testing_data.h"
+#include "common/exceptions/mb_exception.h"
 #include "common/utils/containerutils.h"
 #include "common/utils/mathutils.h"
 
@@ -8,63 +10,56 @@ namespace
 {
 	using namespace mb;
 
-	template<typename StartIt, typename EndIt>
-	ohlcv_data merge_ohlcv(StartIt start, EndIt end, std::time_t targetTime)
-	{
-		double open = start->open();
-		double high = start->high();
-		double low = start->low();
-		double close = start->close();
-		double volume = start->volume();
+	const std::vector<ohlcv_data> NO_DATA;
 
-		for (auto it = std::next(start); it < end; ++it)
-		{
-			const ohlcv_data& data = *it;
+	std::ptrdiff_t find_position(const std::vector<ohlcv_data>& data, std::time_t time)
+	{
+		auto it = std::upper_bound(data.begin(), data.end(), time,
+			[](std::time_t time, const ohlcv_data& item) { return time < item.time_stamp(); });
 
-			high = std::max(high, data.high());
-			low = std::min(low, data.low());
-			close = data.close();
-			volume += data.volume();
-		}
+		return std::distance(data.begin(), it) - 1;
+	}
 
-		return ohlcv_data{ targetTime, open, high, low, close, volume };
+	template<typename ColumnFile>
+	std::ptrdiff_t find_column_position(const ColumnFile& file, std::time_t time)
+	{
+		const std::int64_t* timeStamps{ file.time_stamps() };
+		return std::distance(timeStamps, std::upper_bound(timeStamps, timeStamps + file.size(), time)) - 1;
 	}
 
-	std::optional<data_iterator> get_iterator(const std::vector<ohlcv_data>& data, const tradable_pair& pair, std::time_t time, iterator_cache& cache)
+	void apply_delta(order_book_cache& book, const order_book_delta& delta)
 	{
-		if (data.empty() || time < data.front().time_stamp())
+		if (delta.starts_snapshot())
 		{
-			return std::nullopt;
+			book = order_book_cache{ delta.time_stamp(), ask_cache{}, bid_cache{} };
 		}
 
-		if (time > data.back().time_stamp())
+		book.update_cache(delta.time_stamp(), delta.entry());
+	}
+
+	// The same as walking back from start to the last row at or before targetTime, stopping at the first row,
+	// but galloping so that it costs O(log distance)
+	size_t find_range_start(const std::vector<ohlcv_data>& data, size_t start, std::time_t targetTime)
+	{
+		if (data[start].time_stamp() <= targetTime)
 		{
-			return std::prev(data.end());
+			return start;
 		}
 
-		auto cacheIt = cache.find(pair);
-		auto it = cacheIt == cache.end()
-			? data.begin()
-			: cacheIt->second;
+		size_t after = start;
+		size_t step = 1;
 
-		for (it; it != data.end(); ++it)
+		while (after >= step && data[after - step].time_stamp() > targetTime)
 		{
-			std::time_t timeStamp = it->time_stamp();
-
-			if (timeStamp > time)
-			{
-				--it;
-				break;
-			}
-
-			if (timeStamp == time)
-			{
-				break;
-			}
+			after -= step;
+			step *= 2;
 		}
 
-		cache[pair] = it;
-		return it;
+		auto first = data.begin() + (after >= step ? after - step : 0);
+		auto it = std::upper_bound(first, data.begin() + after, targetTime,
+			[](std::time_t time, const ohlcv_data& item) { return time < item.time_stamp(); });
+
+		return it == data.begin() ? 0 : std::distance(data.begin(), it) - 1;
 	}
 }
 
@@ -77,83 +72,527 @@ namespace mb
 		std::time_t endTime,
 		int step_size,
 		int size,
-		std::unique_ptr<back_testing_data_source> dataSource)
+		std::unique_ptr<back_testing_data_source> dataSource,
+		std::time_t windowSize,
+		size_t memoryBudget)
 		: 
 		_tradablePairs{ std::move(tradablePairs) }, 
-		_data{ std::move(data) }, 
+		_data{ std::make_shared<ohlcv_data_map>(std::move(data)) }, 
 		_startTime{ startTime },
 		_endTime{ endTime },
 		_stepSize{ step_size },
 		_timeSteps{ size },
 		_dataSource{ std::move(dataSource) },
-		_dataTime{ _startTime }, 
-		_iteratorCache{}
-	{}
+		_windowLoader{ _dataSource && windowSize > 0
+			? std::make_unique<ohlcv_window_loader>(*_dataSource, step_size, startTime, endTime, windowSize)
+			: nullptr },
+		_memoryBudget{ memoryBudget },
+		_windowBytes{ 0 },
+		_dataTime{ _startTime }
+	{
+		for (const tradable_pair& pair : _tradablePairs)
+		{
+			auto it = _data->find(pair);
+
+			if (it != _data->end())
+			{
+				add_slot(pair, &it->second);
+			}
+			else
+			{
+				// Loaded on first use when data is loaded dynamically
+				add_slot(pair, _dataSource ? nullptr : &NO_DATA);
+			}
+		}
+
+		for (auto& [pair, pairData] : *_data)
+		{
+			if (_slots.find(pair) == _slots.end())
+			{
+				add_slot(pair, &pairData);
+			}
+		}
+	}
+
+	back_testing_data::back_testing_data(const back_testing_data& other, std::shared_ptr<ohlcv_data_map> data)
+		:
+		_tradablePairs{ other._tradablePairs },
+		_data{ std::move(data) },
+		_startTime{ other._startTime },
+		_endTime{ other._endTime },
+		_stepSize{ other._stepSize },
+		_timeSteps{ other._timeSteps },
+		_dataSource{ nullptr },
+		_windowLoader{ nullptr },
+		_memoryBudget{ 0 },
+		_windowBytes{ 0 },
+		_dataTime{ other._startTime },
+		_slots{ other._slots },
+		_slotPairs{ other._slotPairs },
+		_slotData{ other._slotData },
+		_slotPositions(other._slotData.size()),
+		_slotIndexes{ other._slotIndexes },
+		_slotWindowStarts(other._slotData.size()),
+		_slotWindowEnds(other._slotData.size()),
+		_slotWindowBytes(other._slotData.size()),
+		_slotLastUse(other._slotData.size()),
+		_slotTrades(other._slotData.size()),
+		_slotTradePositions(other._slotData.size()),
+		_slotTradeStarts(other._slotData.size()),
+		_slotBookDeltas(other._slotData.size()),
+		_slotBookPositions(other._slotData.size()),
+		_slotBookStarts(other._slotData.size()),
+		_slotBooks(other._slotData.size())
+	{
+		for (size_t i = 0; i < _slotData.size(); ++i)
+		{
+			_slotPositions[i] = find_position(*_slotData[i], _dataTime);
+			push_event_source(i, event_source_type::CANDLES);
+			set_slot_trades(i, other._slotTrades[i]);
+			set_slot_book_deltas(i, other._slotBookDeltas[i]);
+		}
+	}
 
-	const std::vector<ohlcv_data>& back_testing_data::get_or_load_data(const tradable_pair& pair)
+	void back_testing_data::add_slot(const tradable_pair& pair, const std::vector<ohlcv_data>* data)
 	{
-		auto it = _data.find(pair);
-		if (it != _data.end())
+		_slots.emplace(pair, _slotData.size());
+		_slotPairs.push_back(pair);
+		_slotData.push_back(nullptr);
+		_slotPositions.push_back(-1);
+		_slotIndexes.push_back(nullptr);
+		_slotWindowStarts.push_back(0);
+		_slotWindowEnds.push_back(0);
+		_slotWindowBytes.push_back(0);
+		_slotLastUse.push_back(0);
+		_slotTrades.push_back(nullptr);
+		_slotTradePositions.push_back(-1);
+		_slotTradeStarts.push_back(0);
+		_slotBookDeltas.push_back(nullptr);
+		_slotBookPositions.push_back(-1);
+		_slotBookStarts.push_back(0);
+		_slotBooks.push_back(nullptr);
+
+		if (data)
+		{
+			set_slot_data(_slotData.size() - 1, *data);
+		}
+	}
+
+	void back_testing_data::set_slot_data(size_t slot, const std::vector<ohlcv_data>& data)
+	{
+		bool hadData{ _slotData[slot] != nullptr };
+
+		_slotData[slot] = &data;
+		_slotPositions[slot] = find_position(data, _dataTime);
+		_slotIndexes[slot] = std::make_shared<ohlcv_range_index>(data);
+
+		// A replaced window keeps its queued event, which is pushed again with the new window's time when it is next checked
+		if (!hadData)
 		{
-			return it->second;
+			push_event_source(slot, event_source_type::CANDLES);
 		}
+	}
+
+	void back_testing_data::set_slot_trades(size_t slot, std::shared_ptr<const trade_column_file> trades)
+	{
+		if (trades)
+		{
+			_slotTradePositions[slot] = find_column_position(*trades, _dataTime);
+			_slotTradeStarts[slot] = find_column_position(*trades, _dataTime - _stepSize) + 1;
+		}
+
+		_slotTrades[slot] = std::move(trades);
+		push_event_source(slot, event_source_type::TRADES);
+	}
+
+	void back_testing_data::set_slot_book_deltas(size_t slot, std::shared_ptr<const order_book_delta_file> deltas)
+	{
+		_slotBooks[slot] = nullptr;
+
+		if (deltas)
+		{
+			std::ptrdiff_t position{ find_column_position(*deltas, _dataTime) };
+			std::ptrdiff_t first{ position };
+
+			// Rebuilt from the last snapshot at or before the data time rather than from the first recorded delta
+			while (first > 0 && !(*deltas)[first].starts_snapshot())
+			{
+				--first;
+			}
 
+			auto book = std::make_unique<order_book_cache>(0, ask_cache{}, bid_cache{});
+
+			for (std::ptrdiff_t i = std::max<std::ptrdiff_t>(first, 0); i <= position; ++i)
+			{
+				apply_delta(*book, (*deltas)[i]);
+			}
+
+			_slotBooks[slot] = std::move(book);
+			_slotBookPositions[slot] = position;
+			_slotBookStarts[slot] = find_column_position(*deltas, _dataTime - _stepSize) + 1;
+		}
+
+		_slotBookDeltas[slot] = std::move(deltas);
+		push_event_source(slot, event_source_type::ORDER_BOOK);
+	}
+
+	std::optional<std::time_t> back_testing_data::get_next_source_time(size_t slot, event_source_type type) const
+	{
+		switch (type)
+		{
+		case event_source_type::CANDLES:
+		{
+			const std::vector<ohlcv_data>* data{ _slotData[slot] };
+			size_t next = static_cast<size_t>(_slotPositions[slot] + 1);
+
+			if (data != nullptr && next < data->size())
+			{
+				return (*data)[next].time_stamp();
+			}
+
+			// The next candle may be in the following window, which is loaded once the data time reaches it
+			if (data != nullptr && _slotWindowEnds[slot] > _dataTime)
+			{
+				return _slotWindowEnds[slot];
+			}
+
+			break;
+		}
+		case event_source_type::TRADES:
+		{
+			const trade_column_file* trades{ _slotTrades[slot].get() };
+			size_t next = static_cast<size_t>(_slotTradePositions[slot] + 1);
+
+			if (trades != nullptr && next < trades->size())
+			{
+				return trades->time_stamps()[next];
+			}
+
+			break;
+		}
+		case event_source_type::ORDER_BOOK:
+		{
+			const order_book_delta_file* deltas{ _slotBookDeltas[slot].get() };
+			size_t next = static_cast<size_t>(_slotBookPositions[slot] + 1);
+
+			if (deltas != nullptr && next < deltas->size())
+			{
+				return deltas->time_stamps()[next];
+			}
+
+			break;
+		}
+		}
+
+		return std::nullopt;
+	}
+
+	void back_testing_data::push_event_source(size_t slot, event_source_type type)
+	{
+		std::optional<std::time_t> nextTime{ get_next_source_time(slot, type) };
+
+		if (nextTime)
+		{
+			_eventQueue.push_back(event_source{ *nextTime, slot, type });
+			std::push_heap(_eventQueue.begin(), _eventQueue.end(), std::greater<>{});
+		}
+	}
+
+	size_t back_testing_data::get_or_load_slot(const tradable_pair& pair)
+	{
+		auto it = _slots.find(pair);
+
+		if (it == _slots.end())
+		{
+			add_slot(pair, _dataSource ? nullptr : &NO_DATA);
+			it = _slots.find(pair);
+		}
+
+		size_t slot{ it->second };
+		_slotLastUse[slot] = _dataTime;
+
+		if (_slotData[slot] == nullptr)
+		{
+			// An evicted window was loaded before, so only its candles are loaded again
+			bool evicted{ _slotWindowEnds[slot] != 0 };
+
+			if (_windowLoader)
+			{
+				load_slot_window(slot);
+			}
+			else
+			{
+				set_slot_data(slot, (*_data)[pair] = _dataSource->load_data(pair, _stepSize));
+			}
+
+			if (!evicted)
+			{
+				set_slot_trades(slot, _dataSource->load_trades(pair));
+				set_slot_book_deltas(slot, _dataSource->load_order_book_deltas(pair));
+			}
+		}
+
+		return slot;
+	}
+
+	void back_testing_data::load_slot_window(size_t slot)
+	{
+		const tradable_pair& pair{ _slotPairs[slot] };
+		std::vector<ohlcv_data>& window{ (*_data)[pair] };
+		window = _windowLoader->load_window(pair, _dataTime);
+
+		// The next window loading in the background is counted as the same size as this one until it replaces it
+		_windowBytes -= _slotWindowBytes[slot];
+		_slotWindowBytes[slot] = window.capacity() * sizeof(ohlcv_data) * (_windowLoader->is_prefetching(pair) ? 2 : 1);
+		_windowBytes += _slotWindowBytes[slot];
+
+		_slotWindowStarts[slot] = _windowLoader->window_start(_dataTime);
+		_slotWindowEnds[slot] = _windowLoader->window_end(_dataTime);
+		set_slot_data(slot, window);
+		evict_slot_windows(slot);
+	}
+
+	void back_testing_data::evict_slot_windows(size_t keptSlot)
+	{
+		while (_memoryBudget != 0 && _windowBytes > _memoryBudget)
+		{
+			std::optional<size_t> evictedSlot;
+
+			for (size_t slot = 0; slot < _slotData.size(); ++slot)
+			{
+				if (slot != keptSlot && _slotData[slot] != nullptr && _slotWindowEnds[slot] != 0 &&
+					(!evictedSlot || _slotLastUse[slot] < _slotLastUse[*evictedSlot]))
+				{
+					evictedSlot = slot;
+				}
+			}
+
+			if (!evictedSlot)
+			{
+				return;
+			}
+
+			_data->erase(_slotPairs[*evictedSlot]);
+			_windowBytes -= _slotWindowBytes[*evictedSlot];
+			_slotWindowBytes[*evictedSlot] = 0;
+
+			_slotData[*evictedSlot] = nullptr;
+			_slotIndexes[*evictedSlot] = nullptr;
+			_slotPositions[*evictedSlot] = -1;
+			_windowLoader->cancel_prefetch(_slotPairs[*evictedSlot]);
+		}
+	}
+
+	std::shared_ptr<back_testing_data> back_testing_data::create_cursor() const
+	{
 		if (_dataSource)
 		{
-			std::vector<ohlcv_data> data{ _dataSource->load_data(pair, _stepSize) };
-			return _data[pair] = std::move(data);
+			throw mb_exception{ "Back testing data cannot be shared while it is loaded dynamically" };
 		}
 
-		return _data[pair] = {};
+		return std::shared_ptr<back_testing_data>{ new back_testing_data{ *this, _data } };
+	}
+
+	void back_testing_data::set_trades(const tradable_pair& pair, std::shared_ptr<const trade_column_file> trades)
+	{
+		set_slot_trades(get_or_load_slot(pair), std::move(trades));
+	}
+
+	bool back_testing_data::has_trades(const tradable_pair& pair)
+	{
+		return _slotTrades[get_or_load_slot(pair)] != nullptr;
+	}
+
+	trade_range back_testing_data::get_new_trades(const tradable_pair& pair)
+	{
+		size_t slot{ get_or_load_slot(pair) };
+		const trade_column_file* trades{ _slotTrades[slot].get() };
+
+		if (trades == nullptr)
+		{
+			return trade_range{};
+		}
+
+		return trade_range{ *trades, _slotTradeStarts[slot], static_cast<size_t>(_slotTradePositions[slot] + 1) };
+	}
+
+	void back_testing_data::set_order_book_deltas(const tradable_pair& pair, std::shared_ptr<const order_book_delta_file> deltas)
+	{
+		set_slot_book_deltas(get_or_load_slot(pair), std::move(deltas));
+	}
+
+	bool back_testing_data::has_order_book(const tradable_pair& pair)
+	{
+		return _slotBooks[get_or_load_slot(pair)] != nullptr;
+	}
+
+	order_book_delta_range back_testing_data::get_new_order_book_deltas(const tradable_pair& pair)
+	{
+		size_t slot{ get_or_load_slot(pair) };
+		const order_book_delta_file* deltas{ _slotBookDeltas[slot].get() };
+
+		if (deltas == nullptr)
+		{
+			return order_book_delta_range{};
+		}
+
+		return order_book_delta_range{ *deltas, _slotBookStarts[slot], static_cast<size_t>(_slotBookPositions[slot] + 1) };
 	}
 
 	void back_testing_data::increment()
 	{
-		_dataTime += _stepSize;
+		advance_to(_dataTime + _stepSize);
+	}
+
+	std::optional<std::time_t> back_testing_data::next_event_time()
+	{
+		while (!_eventQueue.empty())
+		{
+			event_source source{ _eventQueue.front() };
+			std::optional<std::time_t> nextTime{ get_next_source_time(source.slot, source.type) };
+
+			if (nextTime == source.nextTime)
+			{
+				return nextTime;
+			}
+
+			std::pop_heap(_eventQueue.begin(), _eventQueue.end(), std::greater<>{});
+			_eventQueue.pop_back();
+
+			if (nextTime)
+			{
+				_eventQueue.push_back(event_source{ *nextTime, source.slot, source.type });
+				std::push_heap(_eventQueue.begin(), _eventQueue.end(), std::greater<>{});
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	bool back_testing_data::increment_to_next_event()
+	{
+		std::optional<std::time_t> nextTime{ next_event_time() };
+
+		if (!nextTime || *nextTime > _endTime)
+		{
+			return false;
+		}
+
+		advance_to(*nextTime);
+		return true;
+	}
+
+	void back_testing_data::advance_to(std::time_t time)
+	{
+		_dataTime = time;
+
+		for (size_t slot = 0; slot < _slotTrades.size(); ++slot)
+		{
+			const trade_column_file* trades{ _slotTrades[slot].get() };
+
+			if (trades == nullptr)
+			{
+				continue;
+			}
+
+			std::ptrdiff_t& position{ _slotTradePositions[slot] };
+			std::ptrdiff_t lastPosition = static_cast<std::ptrdiff_t>(trades->size()) - 1;
+			_slotTradeStarts[slot] = position + 1;
+
+			while (position < lastPosition && trades->time_stamps()[position + 1] <= _dataTime)
+			{
+				++position;
+			}
+		}
+
+		for (size_t slot = 0; slot < _slotBookDeltas.size(); ++slot)
+		{
+			const order_book_delta_file* deltas{ _slotBookDeltas[slot].get() };
+
+			if (deltas == nullptr)
+			{
+				continue;
+			}
+
+			std::ptrdiff_t& position{ _slotBookPositions[slot] };
+			std::ptrdiff_t lastPosition = static_cast<std::ptrdiff_t>(deltas->size()) - 1;
+			_slotBookStarts[slot] = position + 1;
+
+			while (position < lastPosition && deltas->time_stamps()[position + 1] <= _dataTime)
+			{
+				apply_delta(*_slotBooks[slot], (*deltas)[++position]);
+			}
+		}
+
+		for (size_t slot = 0; slot < _slotData.size(); ++slot)
+		{
+			const std::vector<ohlcv_data>* data{ _slotData[slot] };
+
+			if (data == nullptr)
+			{
+				continue;
+			}
+
+			if (_slotWindowEnds[slot] != 0 && _dataTime >= _slotWindowEnds[slot])
+			{
+				load_slot_window(slot);
+				continue;
+			}
+
+			std::ptrdiff_t& position{ _slotPositions[slot] };
+			std::ptrdiff_t lastPosition = static_cast<std::ptrdiff_t>(data->size()) - 1;
+
+			while (position < lastPosition && (*data)[position + 1].time_stamp() <= _dataTime)
+			{
+				++position;
+			}
+		}
 	}
 
 	std::vector<ohlcv_data> back_testing_data::get_ohlcv(const tradable_pair& pair, int interval, int count)
 	{
-		const std::vector<ohlcv_data>& pairData{ get_or_load_data(pair) };
+		size_t slot{ get_or_load_slot(pair) };
 
-		if (pairData.empty())
+		// A window only reaches back as far as its look back, so a longer request widens every window from now on
+		// and reloads this one rather than being cut short at the window's start
+		std::time_t lookBack{ static_cast<std::time_t>(interval) * count };
+
+		if (_slotWindowEnds[slot] != 0 && _dataTime - lookBack < _slotWindowStarts[slot])
 		{
-			return {};
+			_windowLoader->extend_look_back(lookBack);
+			load_slot_window(slot);
 		}
 
-		std::optional<data_iterator> optionalIterator = get_iterator(pairData, pair, _dataTime, _iteratorCache);
-		std::time_t startTime = pairData.begin()->time_stamp();
+		const std::vector<ohlcv_data>& pairData{ *_slotData[slot] };
+		std::ptrdiff_t position{ _slotPositions[slot] };
 
-		if (!optionalIterator.has_value() ||
-			*optionalIterator == pairData.begin() && _dataTime == startTime)
+		if (position < 0 ||
+			position == 0 && _dataTime == pairData.front().time_stamp())
 		{
 			return {};
 		}
 
+		const ohlcv_range_index& index{ *_slotIndexes[slot] };
+		std::time_t startTime = pairData.front().time_stamp();
 		std::time_t targetTime = _dataTime;
-		data_iterator end = *optionalIterator;
+		size_t end = position;
 		std::vector<ohlcv_data> data;
 		data.reserve(count);
 
 		for (int i = 0; i < count; ++i)
 		{
 			targetTime = std::max(targetTime - interval, startTime);
-			data_iterator start = end;
+			size_t start = end;
 
-			if (targetTime + interval > end->time_stamp())
+			if (targetTime + interval > pairData[end].time_stamp())
 			{
 				++end;
 			}
 
-			while (start->time_stamp() > targetTime && start != pairData.begin())
-			{
-				start--;
-			}
-
-			ohlcv_data mergedOhlcv{ merge_ohlcv(start, end, targetTime) };
-			data.emplace_back(std::move(mergedOhlcv));
+			start = find_range_start(pairData, start, targetTime);
+			data.emplace_back(index.merge(start, std::max(end, start + 1), targetTime));
 
-			if (targetTime == startTime && start == pairData.begin())
+			if (targetTime == startTime && start == 0)
 			{
 				break;
 			}
@@ -166,18 +605,25 @@ namespace mb
 
 	trade_update back_testing_data::get_trade(const tradable_pair& pair)
 	{
-		const std::vector<ohlcv_data>& pairData{ get_or_load_data(pair) };
+		size_t slot{ get_or_load_slot(pair) };
 
-		std::optional<data_iterator> iterator = get_iterator(pairData, pair, _dataTime, _iteratorCache);
+		if (const trade_column_file* trades{ _slotTrades[slot].get() })
+		{
+			std::ptrdiff_t tradePosition{ _slotTradePositions[slot] };
+			return tradePosition < 0 ? trade_update{ 0, 0, 0 } : (*trades)[tradePosition];
+		}
 
-		if (!iterator.has_value())
+		const std::vector<ohlcv_data>& pairData{ *_slotData[slot] };
+		std::ptrdiff_t position{ _slotPositions[slot] };
+
+		if (position < 0)
 		{
 			return trade_update{0,0,0};
 		}
 
-		const ohlcv_data& ohlcvData = *iterator.value();
+		const ohlcv_data& ohlcvData = pairData[position];
 		double price;
-		if (std::next(iterator.value()) == pairData.end() && _dataTime > ohlcvData.time_stamp())
+		if (static_cast<size_t>(position) + 1 == pairData.size() && _dataTime > ohlcvData.time_stamp())
 		{
 			price = ohlcvData.close();
 		}
@@ -191,15 +637,21 @@ namespace mb
 
 	order_book_state back_testing_data::get_order_book(const tradable_pair& pair, int depth)
 	{
-		const std::vector<ohlcv_data>& pairData{ get_or_load_data(pair) };
-		std::optional<data_iterator> iterator = get_iterator(pairData, pair, _dataTime, _iteratorCache);
+		size_t slot{ get_or_load_slot(pair) };
+
+		if (_slotBooks[slot])
+		{
+			return _slotBooks[slot]->snapshot(depth);
+		}
+
+		std::ptrdiff_t position{ _slotPositions[slot] };
 
-		if (!iterator.has_value())
+		if (position < 0)
 		{
 			return order_book_state{ 0, {},{} };
 		}
 
-		const ohlcv_data& ohlcvData = *iterator.value();
+		const ohlcv_data& ohlcvData = (*_slotData[slot])[position];
 		return order_book_state
 		{
 			ohlcvData.time_stamp(),
@@ -1,24 +1,76 @@
 #pragma once
 
+#include <optional>
 #include <vector>
 #include <unordered_map>
 
+#include "ohlcv_range_index.h"
 #include "data_loading/back_testing_data_source.h"
+#include "data_loading/ohlcv_window_loader.h"
 #include "trading/tradable_pair.h"
 #include "trading/ohlcv_data.h"
 #include "trading/order_book.h"
 #include "trading/trade_update.h"
+#include "exchanges/websockets/order_book_cache.h"
 
 namespace mb
 {
-	using data_iterator = std::vector<ohlcv_data>::const_iterator;
-	using iterator_cache = std::unordered_map<tradable_pair, data_iterator>;
+	using ohlcv_data_map = std::unordered_map<tradable_pair, std::vector<ohlcv_data>>;
+
+	// Recorded events from one step, oldest first
+	template<typename ColumnFile>
+	class column_range
+	{
+	private:
+		const ColumnFile* _file;
+		size_t _begin;
+		size_t _end;
+
+	public:
+		column_range()
+			: _file{ nullptr }, _begin{ 0 }, _end{ 0 }
+		{}
+
+		column_range(const ColumnFile& file, size_t begin, size_t end)
+			: _file{ &file }, _begin{ begin }, _end{ end }
+		{}
+
+		size_t size() const noexcept { return _end - _begin; }
+		bool empty() const noexcept { return _end == _begin; }
+		auto operator[](size_t index) const noexcept { return (*_file)[_begin + index]; }
+	};
+
+	using trade_range = column_range<trade_column_file>;
+	using order_book_delta_range = column_range<order_book_delta_file>;
+
+	// How a back test moves through time. STEP visits every step, EVENT jumps to the next time any pair has new data
+	enum class time_advance
+	{
+		STEP,
+		EVENT
+	};
 
 	class back_testing_data
 	{
 	private:
+		enum class event_source_type
+		{
+			CANDLES,
+			TRADES,
+			ORDER_BOOK
+		};
+
+		struct event_source
+		{
+			std::time_t nextTime;
+			size_t slot;
+			event_source_type type;
+
+			bool operator>(const event_source& other) const noexcept { return nextTime > other.nextTime; }
+		};
+
 		std::vector<tradable_pair> _tradablePairs;
-		std::unordered_map<tradable_pair, std::vector<ohlcv_data>> _data;
+		std::shared_ptr<ohlcv_data_map> _data;
 		std::time_t _startTime;
 		std::time_t _endTime;
 		int _stepSize;
@@ -26,10 +78,53 @@ namespace mb
 
 		std::unique_ptr<back_testing_data_source> _dataSource;
 
+		// Set when dynamically loaded pairs keep only a window of their candles. Windows are dropped, least recently
+		// used first, while together they take more than the memory budget, and are loaded again when next used
+		std::unique_ptr<ohlcv_window_loader> _windowLoader;
+		size_t _memoryBudget;
+		size_t _windowBytes;
+
 		std::time_t _dataTime;
-		iterator_cache _iteratorCache;
 
-		const std::vector<ohlcv_data>& get_or_load_data(const tradable_pair& pair);
+		// One slot per pair in aligned arrays. A slot's position is the last candle at or before the data time,
+		// or -1 before the first, and is moved forward once per step rather than searched for by every accessor
+		std::unordered_map<tradable_pair, size_t> _slots;
+		std::vector<tradable_pair> _slotPairs;
+		std::vector<const std::vector<ohlcv_data>*> _slotData;
+		std::vector<std::ptrdiff_t> _slotPositions;
+		std::vector<std::shared_ptr<const ohlcv_range_index>> _slotIndexes;
+		std::vector<std::time_t> _slotWindowStarts;
+		std::vector<std::time_t> _slotWindowEnds;
+		std::vector<size_t> _slotWindowBytes;
+		std::vector<std::time_t> _slotLastUse;
+
+		// Trade positions work the same way. A step's new trades start after the previous step's position
+		std::vector<std::shared_ptr<const trade_column_file>> _slotTrades;
+		std::vector<std::ptrdiff_t> _slotTradePositions;
+		std::vector<size_t> _slotTradeStarts;
+
+		// Recorded order books are rebuilt into a cache per slot and kept current as each step's deltas are applied
+		std::vector<std::shared_ptr<const order_book_delta_file>> _slotBookDeltas;
+		std::vector<std::ptrdiff_t> _slotBookPositions;
+		std::vector<size_t> _slotBookStarts;
+		std::vector<std::unique_ptr<order_book_cache>> _slotBooks;
+
+		// A min heap of when each slot's candles, trades and order book next have new data. An entry is checked
+		// against its source when it reaches the top, and pushed again with the source's new time if it has moved on
+		std::vector<event_source> _eventQueue;
+
+		void add_slot(const tradable_pair& pair, const std::vector<ohlcv_data>* data);
+		void set_slot_data(size_t slot, const std::vector<ohlcv_data>& data);
+		void set_slot_trades(size_t slot, std::shared_ptr<const trade_column_file> trades);
+		void set_slot_book_deltas(size_t slot, std::shared_ptr<const order_book_delta_file> deltas);
+		size_t get_or_load_slot(const tradable_pair& pair);
+		void load_slot_window(size_t slot);
+		void evict_slot_windows(size_t keptSlot);
+		std::optional<std::time_t> get_next_source_time(size_t slot, event_source_type type) const;
+		void push_event_source(size_t slot, event_source_type type);
+		void advance_to(std::time_t time);
+
+		back_testing_data(const back_testing_data& other, std::shared_ptr<ohlcv_data_map> data);
 
 	public:
 		back_testing_data(
@@ -39,7 +134,9 @@ namespace mb
 			std::time_t endTime,
 			int stepSize,
 			int timeSteps,
-			std::unique_ptr<back_testing_data_source> dataSource = nullptr);
+			std::unique_ptr<back_testing_data_source> dataSource = nullptr,
+			std::time_t windowSize = 0,
+			size_t memoryBudget = 0);
 
 		std::time_t data_time() const noexcept { return _dataTime; }
 		std::time_t start_time() const noexcept { return _startTime; }
@@ -48,7 +145,28 @@ namespace mb
 		int time_steps() const noexcept { return _timeSteps; }
 		const std::vector<tradable_pair>& tradable_pairs() const noexcept { return _tradablePairs; }
 
+		// A new back test over the same data, starting from the beginning with its own position. The data is
+		// shared rather than copied, so it must be fully loaded up front and both copies treat it as read only
+		std::shared_ptr<back_testing_data> create_cursor() const;
+
+		// Replaces the trade synthesised from each candle with recorded trades
+		void set_trades(const tradable_pair& pair, std::shared_ptr<const trade_column_file> trades);
+		bool has_trades(const tradable_pair& pair);
+		trade_range get_new_trades(const tradable_pair& pair);
+
+		// Replaces the book made from each candle's high and low with a recorded order book
+		void set_order_book_deltas(const tradable_pair& pair, std::shared_ptr<const order_book_delta_file> deltas);
+		bool has_order_book(const tradable_pair& pair);
+		order_book_delta_range get_new_order_book_deltas(const tradable_pair& pair);
+
 		void increment();
+
+		// The earliest time after the data time at which a loaded pair has a new candle, trade or order book change
+		std::optional<std::time_t> next_event_time();
+
+		// Moves straight to the next event time, or returns false when there is none before the end time
+		bool increment_to_next_event();
+
 		std::vector<ohlcv_data> get_ohlcv(const tradable_pair& pair, int interval, int count);
 		trade_update get_trade(const tradable_pair& pair);
 		order_book_state get_order_book(const tradable_pair& pair, int depth = 0);
@@ -1,5 +1,6 @@
 #include "backtest_websocket_stream.h"
 #include "trading/ohlcv_data.h"
+#include "common/utils/containerutils.h"
 
 #include "common/exceptions/not_implemented_exception.h"
 
@@ -9,6 +10,56 @@ namespace mb
 		: _backTestingData{ std::move(backTestingData) }
 	{}
 
+	void backtest_websocket_stream::update_trade_history(const tradable_pair& pair, const trade_update& trade)
+	{
+		auto it = _tradeHistories.find(pair);
+
+		if (it == _tradeHistories.end())
+		{
+			return;
+		}
+
+		std::optional<trade_update> lastTrade{ it->second->last() };
+
+		if (!lastTrade || lastTrade->time_stamp() != trade.time_stamp())
+		{
+			it->second->push(trade);
+		}
+	}
+
+	void backtest_websocket_stream::replay_trades(const tradable_pair& pair)
+	{
+		trade_range trades{ _backTestingData->get_new_trades(pair) };
+		auto historyIt = _tradeHistories.find(pair);
+		bool hasHandler{ has_trade_update_handler() };
+
+		// Every recorded trade is kept and sent in order, including several in the same second
+		for (size_t i = 0; i < trades.size(); ++i)
+		{
+			trade_update trade{ trades[i] };
+
+			if (historyIt != _tradeHistories.end())
+			{
+				historyIt->second->push(trade);
+			}
+
+			if (hasHandler)
+			{
+				fire_trade_update(trade_update_message{ pair, trade });
+			}
+		}
+	}
+
+	void backtest_websocket_stream::replay_order_book(const tradable_pair& pair)
+	{
+		order_book_delta_range deltas{ _backTestingData->get_new_order_book_deltas(pair) };
+
+		for (size_t i = 0; i < deltas.size(); ++i)
+		{
+			fire_order_book_update(order_book_update_message{ pair, deltas[i].entry(), deltas[i].starts_snapshot() });
+		}
+	}
+
 	void backtest_websocket_stream::notify()
 	{
 		for (auto& subscription : _subscriptions)
@@ -17,12 +68,21 @@ namespace mb
 			{
 			case websocket_channel::TRADE:
 			{
+				if (_backTestingData->has_trades(subscription.pair_item()))
+				{
+					replay_trades(subscription.pair_item());
+					break;
+				}
+
+				trade_update trade{ _backTestingData->get_trade(subscription.pair_item()) };
+				update_trade_history(subscription.pair_item(), trade);
+
 				if (has_trade_update_handler())
 				{
 					fire_trade_update(trade_update_message
 						{ 
 							subscription.pair_item(),
-							_backTestingData->get_trade(subscription.pair_item())
+							std::move(trade)
 						});
 				}
 
@@ -49,12 +109,22 @@ namespace mb
 			}
 			case websocket_channel::ORDER_BOOK:
 			{
-				if (has_order_book_update_handler())
+				if (!has_order_book_update_handler())
+				{
+					break;
+				}
+
+				if (_backTestingData->has_order_book(subscription.pair_item()))
+				{
+					replay_order_book(subscription.pair_item());
+				}
+				else
 				{
 					fire_order_book_update(order_book_update_message
 						{ 
 							subscription.pair_item(), 
-							_backTestingData->get_order_book(subscription.pair_item()).asks().front()
+							_backTestingData->get_order_book(subscription.pair_item()).asks().front(),
+							true
 						});
 				}
 
@@ -74,6 +144,11 @@ namespace mb
 					pair,
 					subscription.get_parameter()
 				});
+
+			if (subscription.channel() == websocket_channel::TRADE)
+			{
+				_tradeHistories.try_emplace(pair, std::make_shared<trade_history>(_tradeHistoryDepth));
+			}
 		}
 	}
 
@@ -87,6 +162,11 @@ namespace mb
 					pair,
 					subscription.get_parameter()
 				});
+
+			if (subscription.channel() == websocket_channel::TRADE)
+			{
+				_tradeHistories.erase(pair);
+			}
 		}
 	}
 
@@ -118,4 +198,9 @@ namespace mb
 
 		return candles.front();
 	}
+
+	std::shared_ptr<const trade_history> backtest_websocket_stream::get_trade_history(const tradable_pair& pair) const
+	{
+		return find_or_default<std::shared_ptr<trade_history>>(_tradeHistories, pair);
+	}
 }
\ No newline at end of file
@@ -10,6 +10,11 @@ namespace mb
 	private:
 		std::shared_ptr<back_testing_data> _backTestingData;
 		std::unordered_set<unique_websocket_subscription> _subscriptions;
+		std::unordered_map<tradable_pair, std::shared_ptr<trade_history>> _tradeHistories;
+
+		void update_trade_history(const tradable_pair& pair, const trade_update& trade);
+		void replay_trades(const tradable_pair& pair);
+		void replay_order_book(const tradable_pair& pair);
 
 	public:
 		backtest_websocket_stream(std::shared_ptr<back_testing_data> backTestingData);
@@ -27,5 +32,9 @@ namespace mb
 		order_book_state get_order_book(const tradable_pair& pair, int depth = 0) const override;
 		trade_update get_last_trade(const tradable_pair& pair) const override;
 		ohlcv_data get_last_candle(const tradable_pair& pair, ohlcv_interval interval) const override;
+		std::shared_ptr<const trade_history> get_trade_history(const tradable_pair& pair) const override;
+
+		latency_summary get_round_trip_times() const override { return latency_summary{}; }
+		std::chrono::milliseconds get_message_age(const unique_websocket_subscription& subscription) const override { return std::chrono::milliseconds{ 0 }; }
 	};
 }
\ No newline at end of file
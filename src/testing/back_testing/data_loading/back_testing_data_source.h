@@ -1,5 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <memory>
+
+#include "trade_column_file.h"
+#include "order_book_delta_file.h"
 #include "trading/ohlcv_data.h"
 #include "trading/tradable_pair.h"
 
@@ -11,6 +16,60 @@ namespace mb
 		virtual ~back_testing_data_source() = default;
 
 		virtual std::vector<tradable_pair> get_available_pairs() = 0;
+		// Called from several threads at once during a full load, each time for a different pair
 		virtual std::vector<ohlcv_data> load_data(const tradable_pair& pair, int stepSize) = 0;
+
+		// Candles from startTime up to but not including endTime. Windowed dynamic loading calls this from a background
+		// thread while the back test reads other pairs. Sources that cannot seek load everything and filter it
+		virtual std::vector<ohlcv_data> load_data_range(const tradable_pair& pair, int stepSize, std::time_t startTime, std::time_t endTime)
+		{
+			std::vector<ohlcv_data> data{ load_data(pair, stepSize) };
+			data.erase(
+				std::remove_if(data.begin(), data.end(), [startTime, endTime](const ohlcv_data& item)
+					{
+						return item.time_stamp() < startTime || item.time_stamp() >= endTime;
+					}),
+				data.end());
+
+			return data;
+		}
+
+		// Recorded trades to replay between steps, or nullptr when the source only has candles
+		virtual std::shared_ptr<const trade_column_file> load_trades(const tradable_pair&) { return nullptr; }
+
+		// Recorded order book changes to replay between steps, or nullptr when the source has no order book
+		virtual std::shared_ptr<const order_book_delta_file> load_order_book_deltas(const tradable_pair&) { return nullptr; }
 	};
+
+	namespace internal
+	{
+		// Keeps a candle only once at least stepSize seconds have passed since the last one kept
+		class ohlcv_step_selector
+		{
+		private:
+			int _stepSize;
+			std::time_t _lastTime;
+
+		public:
+			ohlcv_step_selector(int stepSize)
+				: _stepSize{ stepSize }, _lastTime{ -1 }
+			{}
+
+			bool operator()(std::time_t timeStamp)
+			{
+				if (_lastTime != -1 && timeStamp - _lastTime < _stepSize)
+				{
+					return false;
+				}
+
+				_lastTime = timeStamp;
+				return true;
+			}
+
+			bool operator()(const ohlcv_data& data)
+			{
+				return (*this)(data.time_stamp());
+			}
+		};
+	}
 }
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <optional>
+
+#include "column_data_source.h"
+#include "ohlcv_column_file.h"
+#include "common/csv/csv.h"
+#include "logging/logger.h"
+#include "common/exceptions/mb_exception.h"
+
+namespace
+{
+	using namespace mb;
+
+	std::filesystem::path get_column_path(const std::filesystem::path& dataDirectory, const tradable_pair& pair)
+	{
+		std::filesystem::path path{ dataDirectory / pair.to_string('_') };
+		path += OHLCV_COLUMN_EXTENSION;
+
+		return path;
+	}
+
+	// A CSV's kind of data is named by a second extension before .csv, and decides the column file it is converted to
+	std::optional<std::string_view> get_column_extension(const std::filesystem::path& csvPath)
+	{
+		std::string kind{ csvPath.stem().extension().string() };
+
+		if (kind.empty())
+		{
+			return OHLCV_COLUMN_EXTENSION;
+		}
+
+		if (kind == TRADE_COLUMN_EXTENSION)
+		{
+			return TRADE_COLUMN_EXTENSION;
+		}
+
+		if (kind == ORDER_BOOK_DELTA_EXTENSION)
+		{
+			return ORDER_BOOK_DELTA_EXTENSION;
+		}
+
+		return std::nullopt;
+	}
+
+	void convert_csv_file(const std::filesystem::path& csvPath, const std::filesystem::path& columnPath, std::string_view columnExtension)
+	{
+		if (columnExtension == TRADE_COLUMN_EXTENSION)
+		{
+			write_trade_column_file(columnPath, read_trade_csv_file(csvPath));
+		}
+		else if (columnExtension == ORDER_BOOK_DELTA_EXTENSION)
+		{
+			write_order_book_delta_file(columnPath, read_order_book_delta_csv_file(csvPath));
+		}
+		else
+		{
+			write_ohlcv_column_file(columnPath, read_csv_file<ohlcv_data>(csvPath));
+		}
+	}
+
+	std::vector<ohlcv_data> select_rows(const ohlcv_column_file& columns, int stepSize, size_t begin, size_t end)
+	{
+		internal::ohlcv_step_selector selector{ stepSize };
+		std::vector<ohlcv_data> data;
+
+		if (begin < end && stepSize > 0)
+		{
+			std::int64_t timeSpan{ columns.time_stamps()[end - 1] - columns.time_stamps()[begin] };
+			data.reserve(std::min<size_t>(end - begin, timeSpan / stepSize + 1));
+		}
+
+		// Only the time column is touched for rows the step size skips
+		for (size_t i = begin; i < end; ++i)
+		{
+			if (selector(columns.time_stamps()[i]))
+			{
+				data.emplace_back(columns[i]);
+			}
+		}
+
+		return data;
+	}
+}
+
+namespace mb
+{
+	column_data_source::column_data_source(std::filesystem::path dataDirectory)
+		: _dataDirectory{ std::move(dataDirectory) }
+	{}
+
+	std::vector<tradable_pair> column_data_source::get_available_pairs()
+	{
+		std::vector<tradable_pair> pairs;
+
+		for (const auto& directoryEntry : std::filesystem::directory_iterator(_dataDirectory))
+		{
+			if (!directoryEntry.is_regular_file() || directoryEntry.path().extension() != OHLCV_COLUMN_EXTENSION)
+			{
+				continue;
+			}
+
+			try
+			{
+				pairs.emplace_back(parse_tradable_pair(directoryEntry.path().stem().string(), '_'));
+			}
+			catch (const mb_exception& e)
+			{
+				continue;
+			}
+		}
+
+		return pairs;
+	}
+
+	std::vector<ohlcv_data> column_data_source::load_data(const tradable_pair& pair, int stepSize)
+	{
+		ohlcv_column_file columns{ get_column_path(_dataDirectory, pair) };
+		std::vector<ohlcv_data> data{ select_rows(columns, stepSize, 0, columns.size()) };
+
+		if (data.empty())
+		{
+			logger::instance().warning("Data for {} is invalid or empty", pair.to_string('_'));
+		}
+
+		return data;
+	}
+
+	std::vector<ohlcv_data> column_data_source::load_data_range(const tradable_pair& pair, int stepSize, std::time_t startTime, std::time_t endTime)
+	{
+		ohlcv_column_file columns{ get_column_path(_dataDirectory, pair) };
+		const std::int64_t* timeStamps{ columns.time_stamps() };
+
+		// The time column is sorted, so only the pages holding the range are read
+		size_t begin = std::distance(timeStamps, std::lower_bound(timeStamps, timeStamps + columns.size(), startTime));
+		size_t end = std::distance(timeStamps, std::lower_bound(timeStamps, timeStamps + columns.size(), endTime));
+
+		return select_rows(columns, stepSize, begin, end);
+	}
+
+	std::shared_ptr<const trade_column_file> column_data_source::load_trades(const tradable_pair& pair)
+	{
+		return load_trade_column_file(_dataDirectory, pair);
+	}
+
+	std::shared_ptr<const order_book_delta_file> column_data_source::load_order_book_deltas(const tradable_pair& pair)
+	{
+		return load_order_book_delta_file(_dataDirectory, pair);
+	}
+
+	int convert_csv_directory(const std::filesystem::path& directory)
+	{
+		logger& log{ logger::instance() };
+		int converted = 0;
+
+		for (const auto& directoryEntry : std::filesystem::directory_iterator(directory))
+		{
+			const std::filesystem::path& csvPath{ directoryEntry.path() };
+
+			if (!directoryEntry.is_regular_file() || csvPath.extension() != ".csv")
+			{
+				continue;
+			}
+
+			std::optional<std::string_view> columnExtension{ get_column_extension(csvPath) };
+			std::filesystem::path pairName{ csvPath.stem().stem() };
+
+			try
+			{
+				parse_tradable_pair(pairName.string(), '_');
+			}
+			catch (const mb_exception&)
+			{
+				continue;
+			}
+
+			if (!columnExtension)
+			{
+				continue;
+			}
+
+			std::filesystem::path columnPath{ directory / pairName };
+			columnPath += *columnExtension;
+
+			if (std::filesystem::exists(columnPath) && std::filesystem::last_write_time(columnPath) >= std::filesystem::last_write_time(csvPath))
+			{
+				continue;
+			}
+
+			log.info("Converting {0} to {1}", csvPath.filename().string(), columnPath.filename().string());
+			convert_csv_file(csvPath, columnPath, *columnExtension);
+			++converted;
+		}
+
+		return converted;
+	}
+
+	bool is_column_data_file(const std::filesystem::path& path)
+	{
+		if (path.extension() == OHLCV_COLUMN_EXTENSION)
+		{
+			return true;
+		}
+
+		// Recorded trades and order books are only ever read from column files, so their CSVs are always converted
+		std::optional<std::string_view> columnExtension{ get_column_extension(path) };
+		return path.extension() == ".csv" && columnExtension && *columnExtension != OHLCV_COLUMN_EXTENSION;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <filesystem>
+
+#include "back_testing_data_source.h"
+
+namespace mb
+{
+	// Reads the memory mapped column files written by convert_csv_directory
+	class column_data_source : public back_testing_data_source
+	{
+	private:
+		std::filesystem::path _dataDirectory;
+
+	public:
+		column_data_source(std::filesystem::path dataDirectory);
+
+		std::vector<tradable_pair> get_available_pairs() override;
+		std::vector<ohlcv_data> load_data(const tradable_pair& pair, int stepSize) override;
+		std::vector<ohlcv_data> load_data_range(const tradable_pair& pair, int stepSize, std::time_t startTime, std::time_t endTime) override;
+		std::shared_ptr<const trade_column_file> load_trades(const tradable_pair& pair) override;
+		std::shared_ptr<const order_book_delta_file> load_order_book_deltas(const tradable_pair& pair) override;
+	};
+
+	// Writes a column file beside every pair CSV in the directory and returns how many were converted. Candles are
+	// read from <pair>.csv, recorded trades from <pair>.trades.csv and recorded order book changes from <pair>.book.csv
+	int convert_csv_directory(const std::filesystem::path& directory);
+
+	// Whether a file means the directory's back test data is read from column files
+	bool is_column_data_file(const std::filesystem::path& path);
+}
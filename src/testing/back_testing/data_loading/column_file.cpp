@@ -0,0 +1,54 @@
+#include <cstring>
+#include <fmt/format.h>
+
+#include "column_file.h"
+#include "common/exceptions/mb_exception.h"
+
+namespace mb::internal
+{
+	static_assert(sizeof(column_file_header) == 24);
+
+	size_t read_column_file_header(const mapped_file& file, const std::filesystem::path& path, const column_file_format& format)
+	{
+		if (file.size() < sizeof(column_file_header))
+		{
+			throw mb_exception{ fmt::format("{} is too small for the {} file header", path.string(), format.name) };
+		}
+
+		column_file_header header;
+		std::memcpy(&header, file.data(), sizeof(header));
+
+		if (std::memcmp(header.magic, format.magic, sizeof(header.magic)) != 0 || header.version != format.version)
+		{
+			throw mb_exception{ fmt::format("{} is not a version {} {} file", path.string(), format.version, format.name) };
+		}
+
+		// Compared by division first, as a corrupt count can overflow the multiplication
+		size_t columnBytes{ file.size() - sizeof(column_file_header) };
+
+		if (header.count > columnBytes / format.rowSize || header.count * format.rowSize != columnBytes)
+		{
+			throw mb_exception{ fmt::format("{} is truncated", path.string()) };
+		}
+
+		return header.count;
+	}
+
+	std::ofstream create_column_file(const std::filesystem::path& path, const column_file_format& format, size_t count)
+	{
+		std::ofstream stream{ path, std::ios::binary | std::ios::trunc };
+
+		if (!stream)
+		{
+			throw mb_exception{ fmt::format("Could not create {}", path.string()) };
+		}
+
+		column_file_header header{};
+		std::memcpy(header.magic, format.magic, sizeof(header.magic));
+		header.version = format.version;
+		header.count = count;
+
+		stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		return stream;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+#include <vector>
+
+#include "common/file/mapped_file.h"
+
+namespace mb
+{
+	// Column files start with a 24 byte header, followed by count values of each column in turn. Values are stored in
+	// the machine's byte order
+	struct column_file_header
+	{
+		char magic[8];
+		std::uint32_t version;
+		std::uint32_t reserved;
+		std::uint64_t count;
+	};
+
+	// Identifies one kind of column file and the total size of a row across its columns
+	struct column_file_format
+	{
+		char magic[8];
+		std::uint32_t version;
+		std::string_view name;
+		size_t rowSize;
+	};
+
+	namespace internal
+	{
+		// Checks the mapped file has the format's header followed by exactly count rows, and returns the count
+		size_t read_column_file_header(const mapped_file& file, const std::filesystem::path& path, const column_file_format& format);
+
+		std::ofstream create_column_file(const std::filesystem::path& path, const column_file_format& format, size_t count);
+
+		template<typename Row, typename Selector>
+		void write_column(std::ofstream& stream, const std::vector<Row>& rows, Selector selector)
+		{
+			std::vector<decltype(selector(rows.front()))> column;
+			column.reserve(rows.size());
+
+			for (auto& row : rows)
+			{
+				column.push_back(selector(row));
+			}
+
+			stream.write(reinterpret_cast<const char*>(column.data()), column.size() * sizeof(column.front()));
+		}
+
+		// Writes one column per selector, in order. The file is written beside the destination and renamed, so a
+		// process mapping the old file never sees a partial one
+		template<typename Row, typename... Selectors>
+		void write_column_file(const std::filesystem::path& path, const column_file_format& format, const std::vector<Row>& rows, Selectors... selectors)
+		{
+			std::filesystem::path temporaryPath{ path };
+			temporaryPath += ".tmp";
+
+			{
+				std::ofstream stream{ create_column_file(temporaryPath, format, rows.size()) };
+
+				if (!rows.empty())
+				{
+					(write_column(stream, rows, selectors), ...);
+				}
+			}
+
+			std::filesystem::rename(temporaryPath, path);
+		}
+	}
+}
\ No newline at end of file
@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <limits>
+#include <optional>
+
 #include "csv_data_source.h"
 #include "logging/logger.h"
 #include "common/exceptions/mb_exception.h"
@@ -6,28 +10,89 @@ namespace
 {
 	using namespace mb;
 
-	class ohlcv_data_selector
+	// The offset of the first line starting at or after offset, skipping blank lines
+	size_t find_line_start(std::string_view content, size_t offset)
 	{
-	private:
-		int _stepSize;
-		std::time_t _lastTime;
+		if (offset != 0)
+		{
+			offset = content.find('\n', offset - 1);
+			offset = offset == std::string_view::npos ? content.size() : offset + 1;
+		}
 
-	public:
-		ohlcv_data_selector(int stepSize)
-			: _stepSize{ stepSize }, _lastTime{ -1 }
-		{}
+		while (offset < content.size() && (content[offset] == '\n' || content[offset] == '\r'))
+		{
+			++offset;
+		}
+
+		return offset;
+	}
+
+	// Pair files are normally written in time order, so the first line at or after a time can be bisected for by byte
+	// offset. Lines probed out of order show the file is not sorted, and nothing is returned
+	std::optional<size_t> find_first_line_from(std::string_view content, std::time_t time)
+	{
+		size_t low{ 0 };
+		size_t high{ content.size() };
+		std::time_t latestBefore{ std::numeric_limits<std::time_t>::min() };
+		std::time_t earliestAfter{ std::numeric_limits<std::time_t>::max() };
 
-		bool operator()(const ohlcv_data& data)
+		while (low < high)
 		{
-			if (_lastTime != -1 && data.time_stamp() - _lastTime < _stepSize)
+			size_t middle{ low + (high - low) / 2 };
+			size_t lineStart{ find_line_start(content, middle) };
+
+			if (lineStart == content.size())
 			{
-				return false;
+				high = middle;
+				continue;
 			}
 
-			_lastTime = data.time_stamp();
-			return true;
+			std::string_view line{ content.substr(lineStart, content.find_first_of("\r\n", lineStart) - lineStart) };
+			std::time_t lineTime{ from_csv_line<ohlcv_data>(line).time_stamp() };
+
+			if (lineTime < latestBefore || lineTime > earliestAfter)
+			{
+				return std::nullopt;
+			}
+
+			if (lineTime >= time)
+			{
+				earliestAfter = lineTime;
+				high = middle;
+			}
+			else
+			{
+				latestBefore = lineTime;
+				low = middle + 1;
+			}
 		}
-	};
+
+		return find_line_start(content, low);
+	}
+
+	// Reads every line and keeps those in range, for files that are not in time order
+	std::vector<ohlcv_data> read_unsorted_range(const std::filesystem::path& path, int stepSize, std::time_t startTime, std::time_t endTime)
+	{
+		std::vector<ohlcv_data> inRange{ read_csv_file<ohlcv_data>(path, [startTime, endTime](const ohlcv_data& item)
+			{
+				return item.time_stamp() >= startTime && item.time_stamp() < endTime;
+			}) };
+
+		std::sort(inRange.begin(), inRange.end());
+
+		internal::ohlcv_step_selector stepSelector{ stepSize };
+		std::vector<ohlcv_data> data;
+
+		for (const ohlcv_data& item : inRange)
+		{
+			if (stepSelector(item))
+			{
+				data.push_back(item);
+			}
+		}
+
+		return data;
+	}
 }
 
 namespace mb
@@ -51,6 +116,12 @@ namespace mb
 			{
 				std::filesystem::path fileName{ directoryEntry.path().filename() };
 				fileName.replace_extension();
+
+				// Recorded trades and order books sit beside the candles as <pair>.trades.csv and <pair>.book.csv
+				if (fileName.has_extension())
+				{
+					continue;
+				}
 				pairs.emplace_back(parse_tradable_pair(fileName.string(), '_'));
 			}
 			catch (const mb_exception& e)
@@ -70,7 +141,7 @@ namespace mb
 
 		std::filesystem::path path = _dataDirectory / (pairName + ".csv");
 		std::vector<ohlcv_data> data{
-			read_csv_file<ohlcv_data>(path, ohlcv_data_selector{ stepSize }) };
+			read_csv_file<ohlcv_data>(path, internal::ohlcv_step_selector{ stepSize }) };
 
 		if (data.empty())
 		{
@@ -80,4 +151,88 @@ namespace mb
 		std::sort(data.begin(), data.end());
 		return data;
 	}
+
+	std::vector<ohlcv_data> csv_data_source::load_data_range(const tradable_pair& pair, int stepSize, std::time_t startTime, std::time_t endTime)
+	{
+		std::filesystem::path path = _dataDirectory / (pair.to_string('_') + ".csv");
+		std::vector<ohlcv_data> data;
+
+		if (!std::filesystem::exists(path))
+		{
+			return data;
+		}
+
+		if (is_unsorted(pair))
+		{
+			return read_unsorted_range(path, stepSize, startTime, endTime);
+		}
+
+		mapped_file file{ path };
+		std::string_view content{ reinterpret_cast<const char*>(file.data()), file.size() };
+		std::optional<size_t> firstLine{ find_first_line_from(content, startTime) };
+		internal::ohlcv_step_selector stepSelector{ stepSize };
+		std::time_t lastTime{ startTime };
+		bool sorted{ firstLine.has_value() };
+
+		// Windows are read one after another through the same file, so rather than decoding from the top each time,
+		// the window's first line is bisected for and reading stops at the first line past it
+		if (sorted)
+		{
+			stream_lines(content.substr(*firstLine), [&data, &stepSelector, &lastTime, &sorted, endTime](std::string_view line)
+				{
+					ohlcv_data item{ from_csv_line<ohlcv_data>(line) };
+
+					if (item.time_stamp() < lastTime)
+					{
+						sorted = false;
+						return false;
+					}
+
+					if (item.time_stamp() >= endTime)
+					{
+						return false;
+					}
+
+					if (stepSelector(item))
+					{
+						data.push_back(item);
+					}
+
+					lastTime = item.time_stamp();
+					return true;
+				});
+		}
+
+		if (!sorted)
+		{
+			logger::instance().warning("{}.csv is not in time order, so each window reads the whole file", pair.to_string('_'));
+			set_unsorted(pair);
+
+			return read_unsorted_range(path, stepSize, startTime, endTime);
+		}
+
+		return data;
+	}
+
+	bool csv_data_source::is_unsorted(const tradable_pair& pair)
+	{
+		std::lock_guard<std::mutex> lock{ _unsortedPairsMutex };
+		return _unsortedPairs.find(pair) != _unsortedPairs.end();
+	}
+
+	void csv_data_source::set_unsorted(const tradable_pair& pair)
+	{
+		std::lock_guard<std::mutex> lock{ _unsortedPairsMutex };
+		_unsortedPairs.insert(pair);
+	}
+
+	std::shared_ptr<const trade_column_file> csv_data_source::load_trades(const tradable_pair& pair)
+	{
+		return load_trade_column_file(_dataDirectory, pair);
+	}
+
+	std::shared_ptr<const order_book_delta_file> csv_data_source::load_order_book_deltas(const tradable_pair& pair)
+	{
+		return load_order_book_delta_file(_dataDirectory, pair);
+	}
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <filesystem>
+#include <mutex>
+#include <unordered_set>
 
 #include "back_testing_data_source.h"
 
@@ -11,10 +13,20 @@ namespace mb
 	private:
 		std::filesystem::path _dataDirectory;
 
+		// Pairs whose files were found out of time order, which are read in full for every range
+		std::mutex _unsortedPairsMutex;
+		std::unordered_set<tradable_pair> _unsortedPairs;
+
+		bool is_unsorted(const tradable_pair& pair);
+		void set_unsorted(const tradable_pair& pair);
+
 	public:
 		csv_data_source(std::filesystem::path dataDirectory);
 
 		std::vector<tradable_pair> get_available_pairs() override;
 		std::vector<ohlcv_data> load_data(const tradable_pair& pair, int stepSize) override;
+		std::vector<ohlcv_data> load_data_range(const tradable_pair& pair, int stepSize, std::time_t startTime, std::time_t endTime) override;
+		std::shared_ptr<const trade_column_file> load_trades(const tradable_pair& pair) override;
+		std::shared_ptr<const order_book_delta_file> load_order_book_deltas(const tradable_pair& pair) override;
 	};
 }
\ No newline at end of file
@@ -1,11 +1,16 @@
 #include <string_view>
 #include <limits>
+#include <atomic>
+#include <thread>
 
 #include "data_factory.h"
 #include "back_testing_data_source.h"
 #include "csv_data_source.h"
+#include "column_data_source.h"
+#include "ohlcv_column_file.h"
 #include "common/file/file.h"
 #include "common/utils/containerutils.h"
+#include "common/utils/generalutils.h"
 #include "logging/logger.h"
 #include "trading/ohlcv_data.h"
 
@@ -18,6 +23,59 @@ namespace
 		return ((endTime - startTime) / stepSize) + 1;
 	}
 
+	// Pairs are handed out to workers one at a time, so a few large files do not leave the other threads idle
+	std::vector<std::vector<ohlcv_data>> load_pairs_in_parallel(
+		back_testing_data_source* dataSource,
+		const std::vector<tradable_pair>& pairs,
+		int stepSize,
+		int threadCount)
+	{
+		std::vector<std::vector<ohlcv_data>> results(pairs.size());
+		std::vector<std::exception_ptr> errors(threadCount);
+		std::atomic<size_t> nextPair{ 0 };
+
+		auto loadPairs = [&](int workerIndex)
+		{
+			try
+			{
+				for (size_t i = nextPair++; i < pairs.size(); i = nextPair++)
+				{
+					results[i] = dataSource->load_data(pairs[i], stepSize);
+				}
+			}
+			catch (...)
+			{
+				errors[workerIndex] = std::current_exception();
+				nextPair = pairs.size();
+			}
+		};
+
+		std::vector<std::thread> workers;
+		workers.reserve(threadCount - 1);
+
+		for (int i = 1; i < threadCount; ++i)
+		{
+			workers.emplace_back(loadPairs, i);
+		}
+
+		loadPairs(0);
+
+		for (auto& worker : workers)
+		{
+			worker.join();
+		}
+
+		for (auto& error : errors)
+		{
+			if (error)
+			{
+				std::rethrow_exception(error);
+			}
+		}
+
+		return results;
+	}
+
 	void load_data(
 		back_testing_data_source* dataSource,
 		const back_testing_config& config, 
@@ -29,9 +87,16 @@ namespace
 		startTime = std::numeric_limits<long long>::max();
 		endTime = 0;
 
-		for (auto& pair : pairs)
+		std::vector<std::vector<ohlcv_data>> results{ load_pairs_in_parallel(
+			dataSource,
+			pairs,
+			config.step_size(),
+			resolve_thread_count(config.load_threads(), pairs.size())) };
+
+		// Merged in pair order on this thread, so the result does not depend on which worker finished first
+		for (size_t i = 0; i < pairs.size(); ++i)
 		{
-			std::vector<ohlcv_data> data{ dataSource->load_data(pair, config.step_size()) };
+			std::vector<ohlcv_data>& data{ results[i] };
 
 			if (data.empty())
 			{
@@ -41,7 +106,7 @@ namespace
 			startTime = std::min(startTime, data.front().time_stamp());
 			endTime = std::max(endTime, data.back().time_stamp());
 
-			ohlcvData.emplace(pair, std::move(data));
+			ohlcvData.emplace(pairs[i], std::move(data));
 		}
 
 		if (config.start_time() != 0)
@@ -60,6 +125,35 @@ namespace mb
 {
 	std::unique_ptr<back_testing_data_source> create_data_source(std::string_view dataDirectory)
 	{
+		// Column files are mapped rather than parsed, so they are used whenever the directory has been converted or
+		// has recorded trades or order books. Pair CSVs added or changed since then are converted first, so no pair is
+		// dropped or read from a stale file
+		for (const auto& directoryEntry : std::filesystem::directory_iterator(dataDirectory))
+		{
+			if (is_column_data_file(directoryEntry.path()))
+			{
+				logger& log{ logger::instance() };
+
+				try
+				{
+					int converted{ convert_csv_directory(dataDirectory) };
+
+					if (converted > 0)
+					{
+						log.info("Converted {} new or changed CSV files to column files", converted);
+					}
+				}
+				catch (const std::exception& e)
+				{
+					log.warning("Could not update column files, loading back test data from CSV files: {}", e.what());
+					return std::make_unique<csv_data_source>(dataDirectory);
+				}
+
+				log.info("Loading back test data from column files");
+				return std::make_unique<column_data_source>(dataDirectory);
+			}
+		}
+
 		return std::make_unique<csv_data_source>(dataDirectory);
 	}
 
@@ -78,20 +172,45 @@ namespace mb
 		if (config.dynamic_load())
 		{
 			logger::instance().info("Dynamic data loading is enabled");
+
+			return std::make_shared<back_testing_data>(
+				std::move(pairs),
+				std::move(ohlcvData),
+				startTime,
+				endTime,
+				config.step_size(),
+				calculate_time_steps(startTime, endTime, config.step_size()),
+				std::move(dataSource),
+				config.dynamic_load_window(),
+				static_cast<size_t>(config.dynamic_load_memory_mb()) * 1024 * 1024);
 		}
-		else
-		{
-			load_data(dataSource.get(), config, pairs, ohlcvData, startTime, endTime);
-			dataSource = nullptr;
-		}
 
-		return std::make_shared<back_testing_data>(
-			std::move(pairs),
+		load_data(dataSource.get(), config, pairs, ohlcvData, startTime, endTime);
+
+		auto backTestingData = std::make_shared<back_testing_data>(
+			pairs,
 			std::move(ohlcvData),
 			startTime,
 			endTime,
 			config.step_size(),
-			calculate_time_steps(startTime, endTime, config.step_size()),
-			std::move(dataSource));
+			calculate_time_steps(startTime, endTime, config.step_size()));
+
+		// Trade and order book files are mapped rather than read, so attaching them costs nothing until they are replayed
+		for (const tradable_pair& pair : pairs)
+		{
+			if (std::shared_ptr<const trade_column_file> trades{ dataSource->load_trades(pair) })
+			{
+				logger::instance().info("Replaying {0} recorded trades for {1}", trades->size(), pair.to_string('_'));
+				backTestingData->set_trades(pair, std::move(trades));
+			}
+
+			if (std::shared_ptr<const order_book_delta_file> deltas{ dataSource->load_order_book_deltas(pair) })
+			{
+				logger::instance().info("Replaying {0} recorded order book changes for {1}", deltas->size(), pair.to_string('_'));
+				backTestingData->set_order_book_deltas(pair, std::move(deltas));
+			}
+		}
+
+		return backTestingData;
 	}
 }
@@ -0,0 +1,36 @@
+#include <algorithm>
+
+#include "ohlcv_column_file.h"
+
+namespace
+{
+	static_assert(sizeof(std::int64_t) == sizeof(double));
+}
+
+namespace mb
+{
+	ohlcv_column_file::ohlcv_column_file(const std::filesystem::path& path)
+		: _file{ path }, _count{ internal::read_column_file_header(_file, path, OHLCV_COLUMN_FORMAT) }
+	{
+		const std::byte* columns{ _file.data() + sizeof(column_file_header) };
+		_timeStamps = reinterpret_cast<const std::int64_t*>(columns);
+		_open = reinterpret_cast<const double*>(columns + _count * sizeof(double));
+		_high = _open + _count;
+		_low = _high + _count;
+		_close = _low + _count;
+		_volume = _close + _count;
+	}
+
+	void write_ohlcv_column_file(const std::filesystem::path& path, std::vector<ohlcv_data> data)
+	{
+		std::sort(data.begin(), data.end());
+
+		internal::write_column_file(path, OHLCV_COLUMN_FORMAT, data,
+			[](const ohlcv_data& item) { return static_cast<std::int64_t>(item.time_stamp()); },
+			[](const ohlcv_data& item) { return item.open(); },
+			[](const ohlcv_data& item) { return item.high(); },
+			[](const ohlcv_data& item) { return item.low(); },
+			[](const ohlcv_data& item) { return item.close(); },
+			[](const ohlcv_data& item) { return item.volume(); });
+	}
+}
\ No newline at end of file
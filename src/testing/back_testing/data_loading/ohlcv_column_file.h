@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "column_file.h"
+#include "common/file/mapped_file.h"
+#include "trading/ohlcv_data.h"
+
+namespace mb
+{
+	// Columns of time stamps, then opens, highs, lows, closes and volumes, with rows sorted by time
+	constexpr column_file_format OHLCV_COLUMN_FORMAT{ "MBOHLCV", 1, "OHLCV column", 6 * sizeof(double) };
+
+	constexpr std::string_view OHLCV_COLUMN_EXTENSION = ".ohlcv";
+
+	class ohlcv_column_file
+	{
+	private:
+		mapped_file _file;
+		size_t _count;
+		const std::int64_t* _timeStamps;
+		const double* _open;
+		const double* _high;
+		const double* _low;
+		const double* _close;
+		const double* _volume;
+
+	public:
+		explicit ohlcv_column_file(const std::filesystem::path& path);
+
+		size_t size() const noexcept { return _count; }
+		bool empty() const noexcept { return _count == 0; }
+
+		const std::int64_t* time_stamps() const noexcept { return _timeStamps; }
+		const double* open() const noexcept { return _open; }
+		const double* high() const noexcept { return _high; }
+		const double* low() const noexcept { return _low; }
+		const double* close() const noexcept { return _close; }
+		const double* volume() const noexcept { return _volume; }
+
+		ohlcv_data operator[](size_t index) const noexcept
+		{
+			return ohlcv_data{ _timeStamps[index], _open[index], _high[index], _low[index], _close[index], _volume[index] };
+		}
+	};
+
+	void write_ohlcv_column_file(const std::filesystem::path& path, std::vector<ohlcv_data> data);
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include <algorithm>
+
+#include "ohlcv_window_loader.h"
+
+namespace mb
+{
+	ohlcv_window_loader::ohlcv_window_loader(back_testing_data_source& dataSource, int stepSize, std::time_t startTime, std::time_t endTime, std::time_t chunkSize)
+		:
+		_dataSource{ dataSource },
+		_stepSize{ stepSize },
+		_startTime{ startTime },
+		_endTime{ endTime },
+		_chunkSize{ chunkSize },
+		_lookBack{ chunkSize }
+	{}
+
+	std::int64_t ohlcv_window_loader::chunk_index(std::time_t time) const
+	{
+		std::time_t offset{ time - _startTime };
+
+		// Rounded down, so times before the start fall in negative chunks
+		return offset >= 0
+			? offset / _chunkSize
+			: -((-offset + _chunkSize - 1) / _chunkSize);
+	}
+
+	std::vector<ohlcv_data> ohlcv_window_loader::load_chunk_window(const tradable_pair& pair, std::int64_t chunk, std::time_t lookBack) const
+	{
+		return _dataSource.load_data_range(pair, _stepSize, chunk_start(chunk) - lookBack, chunk_start(chunk + 1));
+	}
+
+	std::time_t ohlcv_window_loader::window_start(std::time_t time) const
+	{
+		return chunk_start(chunk_index(time)) - _lookBack;
+	}
+
+	std::time_t ohlcv_window_loader::window_end(std::time_t time) const
+	{
+		return chunk_start(chunk_index(time) + 1);
+	}
+
+	std::vector<ohlcv_data> ohlcv_window_loader::load_window(const tradable_pair& pair, std::time_t time)
+	{
+		std::int64_t chunk{ chunk_index(time) };
+		std::vector<ohlcv_data> window;
+
+		auto it = _prefetches.find(pair);
+
+		// A prefetch started before the look back was extended is too short, so is loaded again
+		if (it != _prefetches.end() && it->second.chunk == chunk && it->second.lookBack == _lookBack)
+		{
+			window = it->second.data.get();
+		}
+		else
+		{
+			window = load_chunk_window(pair, chunk, _lookBack);
+		}
+
+		if (it != _prefetches.end())
+		{
+			_prefetches.erase(it);
+		}
+
+		if (chunk_start(chunk + 1) <= _endTime)
+		{
+			_prefetches.emplace(pair, prefetch
+				{
+					chunk + 1,
+					_lookBack,
+					std::async(std::launch::async, [this, pair, chunk, lookBack = _lookBack]() { return load_chunk_window(pair, chunk + 1, lookBack); })
+				});
+		}
+
+		return window;
+	}
+
+	void ohlcv_window_loader::extend_look_back(std::time_t lookBack)
+	{
+		_lookBack = std::max(_lookBack, lookBack);
+	}
+
+	bool ohlcv_window_loader::is_prefetching(const tradable_pair& pair) const
+	{
+		return _prefetches.find(pair) != _prefetches.end();
+	}
+
+	void ohlcv_window_loader::cancel_prefetch(const tradable_pair& pair)
+	{
+		_prefetches.erase(pair);
+	}
+}
\ No newline at end of file
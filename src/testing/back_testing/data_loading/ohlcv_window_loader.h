@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <future>
+#include <unordered_map>
+#include <vector>
+
+#include "back_testing_data_source.h"
+#include "trading/ohlcv_data.h"
+#include "trading/tradable_pair.h"
+
+namespace mb
+{
+	// Loads a pair's candles a window at a time rather than its whole history. Time is split into chunks from the
+	// start time, and a window holds the chunk containing a time plus a look back before it, one chunk until a
+	// longer one is asked for. Each window handed out starts loading the pair's next window in the background,
+	// ready for when the data time reaches it
+	class ohlcv_window_loader
+	{
+	private:
+		struct prefetch
+		{
+			std::int64_t chunk;
+			std::time_t lookBack;
+			std::future<std::vector<ohlcv_data>> data;
+		};
+
+		back_testing_data_source& _dataSource;
+		int _stepSize;
+		std::time_t _startTime;
+		std::time_t _endTime;
+		std::time_t _chunkSize;
+		std::time_t _lookBack;
+		std::unordered_map<tradable_pair, prefetch> _prefetches;
+
+		std::int64_t chunk_index(std::time_t time) const;
+		std::time_t chunk_start(std::int64_t chunk) const noexcept { return _startTime + chunk * _chunkSize; }
+		std::vector<ohlcv_data> load_chunk_window(const tradable_pair& pair, std::int64_t chunk, std::time_t lookBack) const;
+
+	public:
+		ohlcv_window_loader(back_testing_data_source& dataSource, int stepSize, std::time_t startTime, std::time_t endTime, std::time_t chunkSize);
+
+		// The times covered by the window load_window returns for time
+		std::time_t window_start(std::time_t time) const;
+		std::time_t window_end(std::time_t time) const;
+
+		// Widens every window loaded from now on to reach at least lookBack seconds before its chunk
+		void extend_look_back(std::time_t lookBack);
+
+		std::vector<ohlcv_data> load_window(const tradable_pair& pair, std::time_t time);
+
+		bool is_prefetching(const tradable_pair& pair) const;
+
+		// Drops a pair's background load, waiting for it to finish if it has already started
+		void cancel_prefetch(const tradable_pair& pair);
+	};
+}
\ No newline at end of file
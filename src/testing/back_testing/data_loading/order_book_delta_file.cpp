@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <fmt/format.h>
+
+#include "order_book_delta_file.h"
+#include "common/csv/csv_cell_reader.h"
+#include "common/exceptions/mb_exception.h"
+#include "common/file/file.h"
+
+namespace
+{
+	using namespace mb;
+
+	static_assert(sizeof(std::int64_t) == sizeof(double));
+
+	std::uint8_t to_flags(const order_book_delta& delta)
+	{
+		std::uint8_t flags{ 0 };
+
+		if (delta.entry().side() == order_book_side::BID)
+		{
+			flags |= order_book_delta_file::BID_FLAG;
+		}
+
+		if (delta.starts_snapshot())
+		{
+			flags |= order_book_delta_file::SNAPSHOT_FLAG;
+		}
+
+		return flags;
+	}
+}
+
+namespace mb
+{
+	order_book_delta_file::order_book_delta_file(const std::filesystem::path& path)
+		: _file{ path }, _count{ internal::read_column_file_header(_file, path, ORDER_BOOK_DELTA_FORMAT) }
+	{
+		const std::byte* columns{ _file.data() + sizeof(column_file_header) };
+		_timeStamps = reinterpret_cast<const std::int64_t*>(columns);
+		_prices = reinterpret_cast<const double*>(columns + _count * sizeof(double));
+		_volumes = _prices + _count;
+		_flags = reinterpret_cast<const std::uint8_t*>(_volumes + _count);
+	}
+
+	void write_order_book_delta_file(const std::filesystem::path& path, std::vector<order_book_delta> deltas)
+	{
+		// Stable, so levels changed within the same second are applied in the order they were recorded
+		std::stable_sort(deltas.begin(), deltas.end(), [](const order_book_delta& lhs, const order_book_delta& rhs)
+			{
+				return lhs.time_stamp() < rhs.time_stamp();
+			});
+
+		internal::write_column_file(path, ORDER_BOOK_DELTA_FORMAT, deltas,
+			[](const order_book_delta& delta) { return static_cast<std::int64_t>(delta.time_stamp()); },
+			[](const order_book_delta& delta) { return delta.entry().price(); },
+			[](const order_book_delta& delta) { return delta.entry().volume(); },
+			to_flags);
+	}
+
+	std::vector<order_book_delta> read_order_book_delta_csv_file(const std::filesystem::path& path)
+	{
+		std::vector<order_book_delta> deltas;
+
+		stream_mapped_file(path, [&deltas](std::string_view line)
+			{
+				csv_cell_reader cells{ line };
+
+				std::time_t timeStamp{ cells.next_as<long long>() };
+				std::string_view side{ cells.next() };
+				double price{ cells.next_as<double>() };
+				double volume{ cells.next_as<double>() };
+				bool startsSnapshot{ cells.has_next() && cells.next() == "1" };
+
+				if (side != "ASK" && side != "BID")
+				{
+					throw mb_exception{ fmt::format("Order book side must be ASK or BID, not {}", side) };
+				}
+
+				order_book_side bookSide{ side == "ASK" ? order_book_side::ASK : order_book_side::BID };
+				deltas.emplace_back(timeStamp, order_book_entry{ price, volume, bookSide }, startsSnapshot);
+			});
+
+		return deltas;
+	}
+
+	std::shared_ptr<const order_book_delta_file> load_order_book_delta_file(const std::filesystem::path& directory, const tradable_pair& pair)
+	{
+		std::filesystem::path path{ directory / pair.to_string('_') };
+		path += ORDER_BOOK_DELTA_EXTENSION;
+
+		if (!std::filesystem::exists(path))
+		{
+			return nullptr;
+		}
+
+		return std::make_shared<order_book_delta_file>(path);
+	}
+}
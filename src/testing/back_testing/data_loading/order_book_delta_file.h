@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include "column_file.h"
+#include "common/file/mapped_file.h"
+#include "trading/order_book.h"
+#include "trading/tradable_pair.h"
+
+namespace mb
+{
+	// One level change. A volume of zero removes the level, and a delta that starts a snapshot clears the book first
+	class order_book_delta
+	{
+	private:
+		std::time_t _timeStamp;
+		order_book_entry _entry;
+		bool _startsSnapshot;
+
+	public:
+		constexpr order_book_delta(std::time_t timeStamp, order_book_entry entry, bool startsSnapshot = false)
+			: _timeStamp{ timeStamp }, _entry{ entry }, _startsSnapshot{ startsSnapshot }
+		{}
+
+		constexpr std::time_t time_stamp() const noexcept { return _timeStamp; }
+		constexpr const order_book_entry& entry() const noexcept { return _entry; }
+		constexpr bool starts_snapshot() const noexcept { return _startsSnapshot; }
+	};
+
+	// Columns of time stamps, prices, volumes and one byte flags. Deltas are sorted by time and keep their recorded
+	// order within a second
+	constexpr column_file_format ORDER_BOOK_DELTA_FORMAT{ "MBBOOK", 1, "order book delta", 3 * sizeof(double) + sizeof(std::uint8_t) };
+
+	constexpr std::string_view ORDER_BOOK_DELTA_EXTENSION = ".book";
+
+	class order_book_delta_file
+	{
+	private:
+		mapped_file _file;
+		size_t _count;
+		const std::int64_t* _timeStamps;
+		const double* _prices;
+		const double* _volumes;
+		const std::uint8_t* _flags;
+
+	public:
+		static constexpr std::uint8_t BID_FLAG = 1;
+		static constexpr std::uint8_t SNAPSHOT_FLAG = 2;
+
+		explicit order_book_delta_file(const std::filesystem::path& path);
+
+		size_t size() const noexcept { return _count; }
+		bool empty() const noexcept { return _count == 0; }
+
+		const std::int64_t* time_stamps() const noexcept { return _timeStamps; }
+
+		order_book_delta operator[](size_t index) const noexcept
+		{
+			std::uint8_t flags{ _flags[index] };
+			order_book_side side{ flags & BID_FLAG ? order_book_side::BID : order_book_side::ASK };
+
+			return order_book_delta
+			{
+				_timeStamps[index],
+				order_book_entry{ _prices[index], _volumes[index], side },
+				(flags & SNAPSHOT_FLAG) != 0
+			};
+		}
+	};
+
+	void write_order_book_delta_file(const std::filesystem::path& path, std::vector<order_book_delta> deltas);
+
+	// Reads recorded book changes from CSV lines of time stamp, side (ASK or BID), price, volume and a
+	// final 1 on the first level of each snapshot
+	std::vector<order_book_delta> read_order_book_delta_csv_file(const std::filesystem::path& path);
+
+	// The pair's book delta file in the directory, or nullptr when it has no recorded order book
+	std::shared_ptr<const order_book_delta_file> load_order_book_delta_file(const std::filesystem::path& directory, const tradable_pair& pair);
+}
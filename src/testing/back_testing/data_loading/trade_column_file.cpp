@@ -0,0 +1,67 @@
+#include <algorithm>
+
+#include "trade_column_file.h"
+#include "common/csv/csv_cell_reader.h"
+#include "common/file/file.h"
+
+namespace
+{
+	static_assert(sizeof(std::int64_t) == sizeof(double));
+}
+
+namespace mb
+{
+	trade_column_file::trade_column_file(const std::filesystem::path& path)
+		: _file{ path }, _count{ internal::read_column_file_header(_file, path, TRADE_COLUMN_FORMAT) }
+	{
+		const std::byte* columns{ _file.data() + sizeof(column_file_header) };
+		_timeStamps = reinterpret_cast<const std::int64_t*>(columns);
+		_prices = reinterpret_cast<const double*>(columns + _count * sizeof(double));
+		_volumes = _prices + _count;
+	}
+
+	void write_trade_column_file(const std::filesystem::path& path, std::vector<trade_update> trades)
+	{
+		// Stable, so trades within the same second are replayed in the order they were recorded
+		std::stable_sort(trades.begin(), trades.end(), [](const trade_update& lhs, const trade_update& rhs)
+			{
+				return lhs.time_stamp() < rhs.time_stamp();
+			});
+
+		internal::write_column_file(path, TRADE_COLUMN_FORMAT, trades,
+			[](const trade_update& trade) { return static_cast<std::int64_t>(trade.time_stamp()); },
+			[](const trade_update& trade) { return trade.price(); },
+			[](const trade_update& trade) { return trade.volume(); });
+	}
+
+	std::vector<trade_update> read_trade_csv_file(const std::filesystem::path& path)
+	{
+		std::vector<trade_update> trades;
+
+		stream_mapped_file(path, [&trades](std::string_view line)
+			{
+				csv_cell_reader cells{ line };
+
+				std::time_t timeStamp{ cells.next_as<long long>() };
+				double price{ cells.next_as<double>() };
+				double volume{ cells.next_as<double>() };
+
+				trades.emplace_back(timeStamp, price, volume);
+			});
+
+		return trades;
+	}
+
+	std::shared_ptr<const trade_column_file> load_trade_column_file(const std::filesystem::path& directory, const tradable_pair& pair)
+	{
+		std::filesystem::path path{ directory / pair.to_string('_') };
+		path += TRADE_COLUMN_EXTENSION;
+
+		if (!std::filesystem::exists(path))
+		{
+			return nullptr;
+		}
+
+		return std::make_shared<trade_column_file>(path);
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include "column_file.h"
+#include "common/file/mapped_file.h"
+#include "trading/tradable_pair.h"
+#include "trading/trade_update.h"
+
+namespace mb
+{
+	// Columns of time stamps, prices and volumes. Trades are sorted by time and keep their recorded order within a second
+	constexpr column_file_format TRADE_COLUMN_FORMAT{ "MBTRADE", 1, "trade column", 3 * sizeof(double) };
+
+	constexpr std::string_view TRADE_COLUMN_EXTENSION = ".trades";
+
+	class trade_column_file
+	{
+	private:
+		mapped_file _file;
+		size_t _count;
+		const std::int64_t* _timeStamps;
+		const double* _prices;
+		const double* _volumes;
+
+	public:
+		explicit trade_column_file(const std::filesystem::path& path);
+
+		size_t size() const noexcept { return _count; }
+		bool empty() const noexcept { return _count == 0; }
+
+		const std::int64_t* time_stamps() const noexcept { return _timeStamps; }
+		const double* prices() const noexcept { return _prices; }
+		const double* volumes() const noexcept { return _volumes; }
+
+		trade_update operator[](size_t index) const noexcept
+		{
+			return trade_update{ _timeStamps[index], _prices[index], _volumes[index] };
+		}
+	};
+
+	void write_trade_column_file(const std::filesystem::path& path, std::vector<trade_update> trades);
+
+	// Reads recorded trades from CSV lines of time stamp, price and volume
+	std::vector<trade_update> read_trade_csv_file(const std::filesystem::path& path);
+
+	// The pair's trade file in the directory, or nullptr when it has no recorded trades
+	std::shared_ptr<const trade_column_file> load_trade_column_file(const std::filesystem::path& directory, const tradable_pair& pair);
+}
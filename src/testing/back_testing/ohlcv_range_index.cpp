@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <deque>
+#include <functional>
+
+#include "ohlcv_range_index.h"
+
+namespace
+{
+	using namespace mb;
+
+	int floor_log2(size_t value)
+	{
+		int result = 0;
+
+		while ((size_t{ 2 } << result) <= value)
+		{
+			++result;
+		}
+
+		return result;
+	}
+
+	// The best value in every window of rows, kept in O(n) with a queue of the rows that could still be the best
+	template<typename Selector, typename Compare>
+	std::vector<double> window_extremes(const std::vector<ohlcv_data>& data, size_t window, Selector selector, Compare better)
+	{
+		std::vector<double> extremes(data.size() - window + 1);
+		std::deque<size_t> candidates;
+
+		for (size_t i = 0; i < data.size(); ++i)
+		{
+			while (!candidates.empty() && !better(selector(data[candidates.back()]), selector(data[i])))
+			{
+				candidates.pop_back();
+			}
+
+			candidates.push_back(i);
+
+			if (candidates.front() + window <= i)
+			{
+				candidates.pop_front();
+			}
+
+			if (i + 1 >= window)
+			{
+				extremes[i + 1 - window] = selector(data[candidates.front()]);
+			}
+		}
+
+		return extremes;
+	}
+}
+
+namespace mb
+{
+	ohlcv_range_index::ohlcv_range_index(const std::vector<ohlcv_data>& data)
+		:
+		_data{ data },
+		_volumeSums{},
+		_levels{ std::make_unique<window_level[]>(data.empty() ? 0 : floor_log2(data.size()) + 1) }
+	{}
+
+	const ohlcv_range_index::window_level& ohlcv_range_index::get_level(int level) const
+	{
+		window_level& windows{ _levels[level] };
+
+		std::call_once(windows.built, [this, &windows, level]()
+			{
+				size_t window{ size_t{ 1 } << level };
+				windows.highs = window_extremes(_data, window, [](const ohlcv_data& item) { return item.high(); }, std::greater<double>{});
+				windows.lows = window_extremes(_data, window, [](const ohlcv_data& item) { return item.low(); }, std::less<double>{});
+			});
+
+		return windows;
+	}
+
+	const std::vector<double>& ohlcv_range_index::get_volume_sums() const
+	{
+		std::call_once(_volumeSumsBuilt, [this]()
+			{
+				_volumeSums.reserve(_data.size() + 1);
+				_volumeSums.push_back(0);
+
+				for (auto& item : _data)
+				{
+					_volumeSums.push_back(_volumeSums.back() + item.volume());
+				}
+			});
+
+		return _volumeSums;
+	}
+
+	ohlcv_data ohlcv_range_index::merge(size_t start, size_t end, std::time_t timeStamp) const
+	{
+		const ohlcv_data& first{ _data[start] };
+		size_t length{ end - start };
+
+		if (length == 1)
+		{
+			return ohlcv_data{ timeStamp, first.open(), first.high(), first.low(), first.close(), first.volume() };
+		}
+
+		int level{ floor_log2(length) };
+		size_t lastWindow{ end - (size_t{ 1 } << level) };
+		const window_level& windows{ get_level(level) };
+		const std::vector<double>& volumeSums{ get_volume_sums() };
+
+		return ohlcv_data
+		{
+			timeStamp,
+			first.open(),
+			std::max(windows.highs[start], windows.highs[lastWindow]),
+			std::min(windows.lows[start], windows.lows[lastWindow]),
+			_data[end - 1].close(),
+			volumeSums[end] - volumeSums[start]
+		};
+	}
+}
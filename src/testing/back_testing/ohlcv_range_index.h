@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "trading/ohlcv_data.h"
+
+namespace mb
+{
+	// Merges any run of rows in constant time. Volumes come from prefix sums, and highs and lows from the extremes of
+	// every window of one power of two length, so that any run is covered by two overlapping windows. Each part is
+	// built the first time a query needs it, and the index can be shared between threads once constructed
+	class ohlcv_range_index
+	{
+	private:
+		struct window_level
+		{
+			std::once_flag built;
+			std::vector<double> highs;
+			std::vector<double> lows;
+		};
+
+		const std::vector<ohlcv_data>& _data;
+		mutable std::once_flag _volumeSumsBuilt;
+		mutable std::vector<double> _volumeSums;
+		mutable std::unique_ptr<window_level[]> _levels;
+
+		const window_level& get_level(int level) const;
+		const std::vector<double>& get_volume_sums() const;
+
+	public:
+		explicit ohlcv_range_index(const std::vector<ohlcv_data>& data);
+
+		// Rows [start, end) merged into one candle stamped with timeStamp. The range must not be empty
+		ohlcv_data merge(size_t start, size_t end, std::time_t timeStamp) const;
+	};
+}
@@ -13,6 +13,16 @@ namespace
 	static constexpr int VolumePrecision = 10;
 	static double VolumeModifier = std::pow(10, VolumePrecision);
 
+	template<typename Function>
+	auto run_synchronously(Function function)
+	{
+		std::packaged_task<std::invoke_result_t<Function>()> task{ std::move(function) };
+		auto result = task.get_future();
+		task();
+
+		return result;
+	}
+
 	bool should_close_limit_order(const order_request& request, double currentPrice)
 	{
 		double orderPrice{ request.get(order_request_parameter::ASSET_PRICE) };
@@ -22,6 +32,89 @@ namespace
 			(request.action() == trade_action::SELL && currentPrice >= orderPrice);
 	}
 
+	// A limit order that crosses the recorded book takes the levels at or better than its limit, best first. Paper
+	// orders fill whole, so volume beyond those levels is assumed to rest and fill at the limit price
+	std::optional<double> cross_order_book(const order_request& request, const std::optional<order_book_state>& orderBook)
+	{
+		if (!orderBook)
+		{
+			return std::nullopt;
+		}
+
+		bool buy{ request.action() == trade_action::BUY };
+		const std::vector<order_book_entry>& levels{ buy ? orderBook->asks() : orderBook->bids() };
+		double limitPrice{ request.get(order_request_parameter::ASSET_PRICE) };
+		double volume{ request.get(order_request_parameter::VOLUME) };
+
+		auto crosses = [buy, limitPrice](const order_book_entry& level)
+		{
+			return buy ? level.price() <= limitPrice : level.price() >= limitPrice;
+		};
+
+		if (levels.empty() || !crosses(levels.front()))
+		{
+			return std::nullopt;
+		}
+
+		if (volume <= 0.0)
+		{
+			return levels.front().price();
+		}
+
+		double remaining = volume;
+		double cost = 0.0;
+
+		for (const order_book_entry& level : levels)
+		{
+			if (remaining <= 0.0 || !crosses(level))
+			{
+				break;
+			}
+
+			double filled = std::min(remaining, level.volume());
+			cost += filled * level.price();
+			remaining -= filled;
+		}
+
+		if (remaining > 0.0)
+		{
+			cost += remaining * limitPrice;
+		}
+
+		return cost / volume;
+	}
+
+	// Volume beyond the recorded depth is assumed to fill at the deepest recorded price
+	double walk_order_book(const std::vector<order_book_entry>& levels, double volume)
+	{
+		if (volume <= 0.0)
+		{
+			return levels.front().price();
+		}
+
+		double remaining = volume;
+		double cost = 0.0;
+
+		for (const order_book_entry& level : levels)
+		{
+			double filled = std::min(remaining, level.volume());
+			cost += filled * level.price();
+			remaining -= filled;
+
+			if (remaining <= 0.0)
+			{
+				break;
+			}
+		}
+
+		if (remaining > 0.0)
+		{
+			cost += remaining * levels.back().price();
+		}
+
+		return cost / volume;
+	}
+
 	bool should_close_stop_loss_order(const order_request& request, double currentPrice)
 	{
 		double orderPrice{ request.get(order_request_parameter::STOP_PRICE) };
@@ -79,10 +172,12 @@ namespace mb
 		paper_trading_config config,
 		std::shared_ptr<websocket_stream> websocketStream,
 		std::string_view exchangeId,
-		get_time_function getTime)
+		get_time_function getTime,
+		get_order_book_function getOrderBook)
 		:
 		_websocketStream{ std::move(websocketStream) },
 		_getTime{ std::move(getTime) },
+		_getOrderBook{ std::move(getOrderBook) },
 		_exchangeId{ exchangeId },
 		_fee{ config.fee() },
 		_balances{ create_initialised_balances(config.balances()) },
@@ -103,10 +198,19 @@ namespace mb
 		return balanceIt->second >= amount;
 	}
 
-	bool paper_trade_api::try_fill_order(std::string_view orderId)
+	std::optional<order_book_state> paper_trade_api::get_recorded_order_book(const tradable_pair& pair, int depth) const
+	{
+		if (!_getOrderBook)
+		{
+			return std::nullopt;
+		}
+
+		return _getOrderBook(pair, depth);
+	}
+
+	bool paper_trade_api::try_fill_order(std::string_view orderId, double price)
 	{
 		order_request& request{ _openOrders.at(orderId.data()) };
-		double price{ _websocketStream->get_last_trade(request.pair()).price() };
 
 		if (price == 0.0)
 		{
@@ -120,15 +224,32 @@ namespace mb
 		{
 		case order_type::MARKET:
 		{
-			fillPrice = price;
+			std::optional<order_book_state> orderBook{ get_recorded_order_book(request.pair(), 0) };
+			const std::vector<order_book_entry>* levels{ nullptr };
+
+			if (orderBook)
+			{
+				levels = request.action() == trade_action::BUY ? &orderBook->asks() : &orderBook->bids();
+			}
+
+			fillPrice = levels == nullptr || levels->empty()
+				? price
+				: walk_order_book(*levels, request.get(order_request_parameter::VOLUME));
 			fill = true;
 			break;
 		}
 		case order_type::LIMIT:
 		{
-			fill = should_close_limit_order(request, price);
-			if (fill)
+			std::optional<double> bookPrice{ cross_order_book(request, get_recorded_order_book(request.pair(), 0)) };
+
+			if (bookPrice)
 			{
+				fill = true;
+				fillPrice = *bookPrice;
+			}
+			else if (should_close_limit_order(request, price))
+			{
+				fill = true;
 				fillPrice = request.get(order_request_parameter::ASSET_PRICE);
 			}
 
@@ -227,7 +348,8 @@ namespace mb
 		{
 			auto it = orderIds.begin() + index;
 
-			if (!contains(_openOrders, *it) || try_fill_order(*it))
+			// Filled at the price of the trade that arrived, which may not be the latest when trades are replayed
+			if (!contains(_openOrders, *it) || try_fill_order(*it, message.trade().price()))
 			{
 				orderIds.erase(it);
 			}
@@ -286,7 +408,7 @@ namespace mb
 			_websocketStream->subscribe(websocket_subscription::create_trade_sub({ request.pair() }));
 		}
 
-		try_fill_order(orderId);
+		try_fill_order(orderId, _websocketStream->get_last_trade(request.pair()).price());
 		
 		return orderId;
 	}
@@ -319,6 +441,17 @@ namespace mb
 		_openOrders.erase(it);
 	}
 
+	// Paper orders are filled in memory, so they complete before returning. This keeps back tests deterministic
+	std::future<std::string> paper_trade_api::add_order_async(const order_request& description)
+	{
+		return run_synchronously([this, &description]() { return add_order(description); });
+	}
+
+	std::future<void> paper_trade_api::cancel_order_async(std::string_view orderId)
+	{
+		return run_synchronously([this, orderId]() { cancel_order(orderId); });
+	}
+
 	order_status paper_trade_api::get_order_status(std::string_view orderId) const
 	{
 		std::lock_guard lock{ _tradingMutex };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <unordered_map>
 #include <string>
 
@@ -10,6 +11,7 @@
 #include "trading/tradable_pair.h"
 #include "trading/order_request.h"
 #include "trading/order_description.h"
+#include "trading/order_book.h"
 #include "common/utils/timeutils.h"
 #include "common/types/concurrent_wrapper.h"
 
@@ -19,11 +21,16 @@ namespace mb
 
 	class paper_trade_api : public trade_api
 	{
+	public:
+		// Returns a recorded order book to fill against, or nothing to fill at the last trade price
+		using get_order_book_function = std::function<std::optional<order_book_state>(const tradable_pair&, int depth)>;
+
 	private:
 		using get_time_function = std::function<std::time_t()>;
 
 		std::shared_ptr<websocket_stream> _websocketStream;
 		get_time_function _getTime;
+		get_order_book_function _getOrderBook;
 		std::string_view _exchangeId;
 		double _fee;
 		std::unordered_map<std::string, double> _trailingOrderLimits;
@@ -35,7 +42,8 @@ namespace mb
 		mutable std::mutex _tradingMutex;
 
 		bool has_sufficient_funds(const std::string& asset, volume_t amount) const;
-		bool try_fill_order(std::string_view orderId);
+		std::optional<order_book_state> get_recorded_order_book(const tradable_pair& pair, int depth) const;
+		bool try_fill_order(std::string_view orderId, double price);
 		void execute_order(std::string_view orderId, order_request& request, double fillPrice);
 		void trade_update_handler(trade_update_message message);
 
@@ -44,7 +52,8 @@ namespace mb
 			paper_trading_config config,
 			std::shared_ptr<websocket_stream> websocketStream,
 			std::string_view exchangeId,
-			get_time_function getTime);
+			get_time_function getTime,
+			get_order_book_function getOrderBook = nullptr);
 
 		std::string_view exchange_id() const noexcept { return _exchangeId; }
 
@@ -55,12 +64,18 @@ namespace mb
 		std::string add_order(const order_request& description) override;
 		order_confirmation add_order_confirm(const order_request& description) override;
 		void cancel_order(std::string_view orderId) override;
+		std::future<std::string> add_order_async(const order_request& description) override;
+		std::future<void> cancel_order_async(std::string_view orderId) override;
 
 		order_status get_order_status(std::string_view orderId) const;
 	};
 
 	template<typename GetTime>
-	std::shared_ptr<paper_trade_api> create_paper_trade_api(std::string_view id, std::shared_ptr<websocket_stream> websocketStream, GetTime getTime)
+	std::shared_ptr<paper_trade_api> create_paper_trade_api(
+		std::string_view id,
+		std::shared_ptr<websocket_stream> websocketStream,
+		GetTime getTime,
+		paper_trade_api::get_order_book_function getOrderBook = nullptr)
 	{
 		paper_trading_config config{ internal::load_or_create_config<paper_trading_config>() };
 
@@ -68,6 +83,7 @@ namespace mb
 			std::move(config),
 			std::move(websocketStream),
 			id,
-			std::move(getTime));
+			std::move(getTime),
+			std::move(getOrderBook));
 	}
 }
\ No newline at end of file
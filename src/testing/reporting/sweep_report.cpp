@@ -0,0 +1,42 @@
+#include <algorithm>
+#include <sstream>
+
+#include "sweep_report.h"
+#include "common/utils/mathutils.h"
+
+namespace mb
+{
+	sweep_result::sweep_result(int run, double score, test_report report)
+		: _run{ run }, _score{ score }, _report{ std::move(report) }
+	{}
+
+	void rank_sweep_results(std::vector<sweep_result>& results)
+	{
+		std::stable_sort(results.begin(), results.end(), [](const sweep_result& lhs, const sweep_result& rhs)
+			{
+				return lhs.score() != rhs.score()
+					? lhs.score() > rhs.score()
+					: lhs.run() < rhs.run();
+			});
+	}
+
+	std::string generate_sweep_summary_string(const std::vector<sweep_result>& rankedResults)
+	{
+		std::stringstream stream;
+		stream << "Sweep Summary" << std::endl;
+		stream << "--------------------" << std::endl;
+		stream << "Rank, Run, Score, Trades" << std::endl;
+
+		for (int rank = 0; rank < rankedResults.size(); ++rank)
+		{
+			const sweep_result& result{ rankedResults[rank] };
+
+			stream << rank + 1 << ", " 
+				<< result.run() << ", " 
+				<< to_string(result.score(), 8) << ", " 
+				<< result.report().trades_count() << std::endl;
+		}
+
+		return stream.str();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+
+#include "test_report.h"
+
+namespace mb
+{
+	// The outcome of one strategy configuration in a parameter sweep
+	class sweep_result
+	{
+	private:
+		int _run;
+		double _score;
+		test_report _report;
+
+	public:
+		sweep_result(int run, double score, test_report report);
+
+		int run() const noexcept { return _run; }
+		double score() const noexcept { return _score; }
+		const test_report& report() const noexcept { return _report; }
+	};
+
+	// Highest score first, with ties kept in run order so the ranking does not depend on which thread finished first
+	void rank_sweep_results(std::vector<sweep_result>& results);
+
+	std::string generate_sweep_summary_string(const std::vector<sweep_result>& rankedResults);
+}
@@ -9,18 +9,6 @@ namespace
 {
 	using namespace mb;
 
-	std::filesystem::path get_output_path()
-	{
-		std::time_t time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-		std::string resultsFolderName = to_string(time, "%d%m%Y_%H%M%S");
-
-		std::filesystem::path path{ get_local_directory() };
-		path /= "test_results";
-		path /= resultsFolderName;
-
-		return path;
-	}
-
 	file_handler create_trades_file(std::filesystem::path path)
 	{
 		static constexpr std::string_view TRADES_FILENAME = "trades.csv";
@@ -116,6 +104,18 @@ namespace
 
 namespace mb
 {
+	std::filesystem::path get_test_output_path()
+	{
+		std::time_t time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+		std::string resultsFolderName = to_string(time, "%d%m%Y_%H%M%S");
+
+		std::filesystem::path path{ get_local_directory() };
+		path /= "test_results";
+		path /= resultsFolderName;
+
+		return path;
+	}
+
 	test_logger_exchange_data::test_logger_exchange_data(std::shared_ptr<paper_trade_api> tradeApi)
 		: _tradeApi{ tradeApi }, _initialBalances{ _tradeApi->get_balances() }, _closedOrderIndex{ 0 }
 	{}
@@ -188,7 +188,11 @@ namespace mb
 
 	test_logger create_test_logger(std::vector<std::shared_ptr<paper_trade_api>> tradeApis)
 	{
-		std::filesystem::path path{ get_output_path() };
+		return create_test_logger(std::move(tradeApis), get_test_output_path());
+	}
+
+	test_logger create_test_logger(std::vector<std::shared_ptr<paper_trade_api>> tradeApis, std::filesystem::path path)
+	{
 		std::filesystem::create_directories(path);
 
 		logger::instance().info("Test results will be written to {}", path.string());
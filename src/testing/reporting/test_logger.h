@@ -45,5 +45,9 @@ namespace mb
 		void log_test_report(const test_report& report) const;
 	};
 
+	// A new time stamped folder under the local test results directory
+	std::filesystem::path get_test_output_path();
+
 	test_logger create_test_logger(std::vector<std::shared_ptr<paper_trade_api>> tradeApis);
+	test_logger create_test_logger(std::vector<std::shared_ptr<paper_trade_api>> tradeApis, std::filesystem::path outputDirectory);
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "ohlcv_data.h"
+#include "common/csv/csv_cell_reader.h"
 
 namespace mb
 {
@@ -15,4 +16,19 @@ namespace mb
 			std::stod(row.get_cell(5))
 		};
 	}
+
+	template<>
+	ohlcv_data from_csv_line(std::string_view line)
+	{
+		csv_cell_reader cells{ line };
+
+		std::time_t timeStamp{ cells.next_as<long long>() };
+		double open{ cells.next_as<double>() };
+		double high{ cells.next_as<double>() };
+		double low{ cells.next_as<double>() };
+		double close{ cells.next_as<double>() };
+		double volume{ cells.next_as<double>() };
+
+		return ohlcv_data{ timeStamp, open, high, low, close, volume };
+	}
 }
\ No newline at end of file
@@ -58,4 +58,7 @@ namespace mb
 
 	template<>
 	ohlcv_data from_csv_row(const csv_row& row);
+
+	template<>
+	ohlcv_data from_csv_line(std::string_view line);
 }
\ No newline at end of file
@@ -10,7 +10,8 @@ namespace mb
 	tradable_pair::tradable_pair(std::string asset, std::string priceUnit)
 		:
 		_asset{ std::move(asset) },
-		_priceUnit{ std::move(priceUnit) }
+		_priceUnit{ std::move(priceUnit) },
+		_hash{ std::hash<std::string>()(_asset) ^ std::hash<std::string>()(_priceUnit) }
 	{}
 
 	bool tradable_pair::contains(std::string_view assetTicker) const noexcept
@@ -35,7 +36,7 @@ namespace mb
 
 	bool tradable_pair::operator==(const tradable_pair& other) const noexcept
 	{
-		return _asset == other._asset && _priceUnit == other._priceUnit;
+		return _hash == other._hash && _asset == other._asset && _priceUnit == other._priceUnit;
 	}
 
 	std::string_view get_gained_asset(const tradable_pair& pair, trade_action action)
@@ -15,11 +15,15 @@ namespace mb
 		std::string _asset;
 		std::string _priceUnit;
 
+		// Pairs are used as map keys on every back test and stream access, so the hash is worked out once
+		std::size_t _hash;
+
 	public:
 		tradable_pair(std::string asset, std::string priceUnit);
 
 		const std::string& asset() const noexcept { return _asset; }
 		const std::string& price_unit() const noexcept { return _priceUnit; }
+		std::size_t hash() const noexcept { return _hash; }
 
 		bool contains(std::string_view assetTicker) const noexcept;
 		std::string to_string(char separator) const;
@@ -51,9 +55,9 @@ namespace std
 	template<>
 	struct hash<mb::tradable_pair>
 	{
-		std::size_t operator()(const mb::tradable_pair& pair) const
+		std::size_t operator()(const mb::tradable_pair& pair) const noexcept
 		{
-			return std::hash<std::string>()(pair.asset()) ^ std::hash<std::string>()(pair.price_unit());
+			return pair.hash();
 		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <algorithm>
+
+#include "trade_history.h"
+#include "common/exceptions/mb_exception.h"
+
+namespace mb
+{
+	trade_history::trade_history(std::size_t capacity)
+		:
+		_capacity{ capacity },
+		_slotCount{ capacity + 1 },
+		_slots{ std::make_unique<slot[]>(_slotCount) },
+		_head{ 0 }
+	{
+		if (_capacity == 0)
+		{
+			throw mb_exception{ "Trade history capacity must be greater than zero" };
+		}
+	}
+
+	std::size_t trade_history::size() const noexcept
+	{
+		return std::min(_head.load(std::memory_order_acquire), _capacity);
+	}
+
+	void trade_history::push(const trade_update& trade) noexcept
+	{
+		std::size_t head{ _head.load(std::memory_order_relaxed) };
+		slot& target{ _slots[head % _slotCount] };
+
+		target.timeStamp.store(trade.time_stamp(), std::memory_order_release);
+		target.price.store(trade.price(), std::memory_order_release);
+		target.volume.store(trade.volume(), std::memory_order_release);
+
+		_head.store(head + 1, std::memory_order_release);
+	}
+
+	std::vector<trade_update> trade_history::get_trades(std::size_t count) const
+	{
+		std::size_t head{ _head.load(std::memory_order_acquire) };
+		std::size_t available{ std::min(head, _capacity) };
+
+		if (count == 0 || count > available)
+		{
+			count = available;
+		}
+
+		std::vector<trade_update> trades;
+		trades.reserve(count);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const slot& source{ _slots[(head - i - 1) % _slotCount] };
+
+			trades.emplace_back(
+				source.timeStamp.load(std::memory_order_relaxed),
+				source.price.load(std::memory_order_relaxed),
+				source.volume.load(std::memory_order_relaxed));
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		// The writer may have wrapped round while copying, so drop any slots it could have started to overwrite
+		std::size_t latestHead{ _head.load(std::memory_order_relaxed) };
+
+		if (latestHead > _capacity)
+		{
+			std::size_t oldestValid{ latestHead - _capacity };
+			std::size_t valid{ head > oldestValid ? head - oldestValid : 0 };
+
+			trades.resize(std::min(trades.size(), valid));
+		}
+
+		return trades;
+	}
+
+	std::optional<trade_update> trade_history::last() const noexcept
+	{
+		while (true)
+		{
+			std::size_t head{ _head.load(std::memory_order_acquire) };
+
+			if (head == 0)
+			{
+				return std::nullopt;
+			}
+
+			const slot& source{ _slots[(head - 1) % _slotCount] };
+
+			trade_update trade
+			{
+				source.timeStamp.load(std::memory_order_relaxed),
+				source.price.load(std::memory_order_relaxed),
+				source.volume.load(std::memory_order_relaxed)
+			};
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			// Only a writer that has since lapped the whole buffer can have overwritten the slot, in which case read again
+			if (_head.load(std::memory_order_relaxed) - head < _capacity)
+			{
+				return trade;
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "trade_update.h"
+
+namespace mb
+{
+	// Fixed capacity ring buffer of recent trades. Supports a single writer and any number of
+	// concurrent readers; neither side takes a lock and readers never block the writer.
+	class trade_history
+	{
+	private:
+		struct slot
+		{
+			std::atomic<std::time_t> timeStamp;
+			std::atomic<double> price;
+			std::atomic<double> volume;
+		};
+
+		std::size_t _capacity;
+		std::size_t _slotCount;
+		std::unique_ptr<slot[]> _slots;
+		std::atomic<std::size_t> _head;
+
+	public:
+		explicit trade_history(std::size_t capacity);
+
+		std::size_t capacity() const noexcept { return _capacity; }
+		std::size_t size() const noexcept;
+
+		void push(const trade_update& trade) noexcept;
+		std::vector<trade_update> get_trades(std::size_t count = 0) const;
+
+		// The most recent trade, without allocating
+		std::optional<trade_update> last() const noexcept;
+	};
+}
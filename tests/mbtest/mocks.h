@@ -15,6 +15,7 @@ namespace mb::test
 	{
 	public:
 		MOCK_METHOD(http_response, send, (const http_request& request), (const, override));
+		MOCK_METHOD(std::future<http_response>, send_async, (const http_request& request), (const, override));
 	};
 
 	class mock_websocket_stream : public websocket_stream
@@ -31,6 +32,9 @@ namespace mb::test
 		MOCK_METHOD(order_book_state, get_order_book, (const tradable_pair& pair, int depth), (const, override));
 		MOCK_METHOD(trade_update, get_last_trade, (const tradable_pair& pair), (const, override));
 		MOCK_METHOD(ohlcv_data, get_last_candle, (const tradable_pair& pair, ohlcv_interval interval), (const, override));
+		MOCK_METHOD(std::shared_ptr<const trade_history>, get_trade_history, (const tradable_pair& pair), (const, override));
+		MOCK_METHOD(latency_summary, get_round_trip_times, (), (const, override));
+		MOCK_METHOD(std::chrono::milliseconds, get_message_age, (const unique_websocket_subscription& subscription), (const, override));
 
 		void expose_fire_trade_update(trade_update_message message)
 		{
@@ -132,6 +136,7 @@ namespace mb::test
 		MOCK_METHOD(ws_connection_status, connection_status, (), (const, override));
 		MOCK_METHOD(void, close, (), (override));
 		MOCK_METHOD(void, send_message, (std::string message), (override));
+		MOCK_METHOD(latency_summary, round_trip_times, (), (const, override));
 	};
 
 	class mock_back_testing_data_source : public back_testing_data_source
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <cctype>
+#include <filesystem>
+#include <string>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace mb::test
+{
+	// Names the directory after the running test and process so tests can run in parallel under ctest -j
+	inline std::filesystem::path test_temp_directory()
+	{
+		const testing::TestInfo* testInfo{ testing::UnitTest::GetInstance()->current_test_info() };
+
+#ifdef _WIN32
+		int processId{ _getpid() };
+#else
+		int processId{ static_cast<int>(getpid()) };
+#endif
+
+		std::string name{ "mb_" };
+		name.append(testInfo->test_suite_name()).append("_").append(testInfo->name()).append("_").append(std::to_string(processId));
+
+		for (char& character : name)
+		{
+			if (!std::isalnum(static_cast<unsigned char>(character)))
+			{
+				character = '_';
+			}
+		}
+
+		return std::filesystem::temp_directory_path() / name;
+	}
+
+	class temp_directory_test : public testing::Test
+	{
+	protected:
+		std::filesystem::path _directory{ test_temp_directory() };
+
+		void SetUp() override
+		{
+			std::filesystem::remove_all(_directory);
+			std::filesystem::create_directories(_directory);
+		}
+
+		void TearDown() override
+		{
+			std::filesystem::remove_all(_directory);
+		}
+	};
+}
\ No newline at end of file
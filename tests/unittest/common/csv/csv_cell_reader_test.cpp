@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <fstream>
+
+#include "common/csv/csv.h"
+#include "common/csv/csv_cell_reader.h"
+#include "common/exceptions/mb_exception.h"
+#include "trading/ohlcv_data.h"
+#include "mbtest/assertion_helpers.h"
+#include "mbtest/temp_directory.h"
+
+namespace mb::test
+{
+	TEST(CsvCellReader, SplitsCellsIncludingEmptyOnes)
+	{
+		csv_cell_reader cells{ "a,,b," };
+
+		EXPECT_EQ("a", cells.next());
+		EXPECT_EQ("", cells.next());
+		EXPECT_EQ("b", cells.next());
+		EXPECT_EQ("", cells.next());
+		EXPECT_FALSE(cells.has_next());
+	}
+
+	TEST(CsvCellReader, ParsesNumbers)
+	{
+		csv_cell_reader cells{ "1609459200,29000.5,-0.25" };
+
+		EXPECT_EQ(1609459200, cells.next_as<long long>());
+		EXPECT_DOUBLE_EQ(29000.5, cells.next_as<double>());
+		EXPECT_DOUBLE_EQ(-0.25, cells.next_as<double>());
+	}
+
+	TEST(CsvCellReader, InvalidNumberThrows)
+	{
+		csv_cell_reader cells{ "abc,1" };
+
+		EXPECT_THROW(cells.next_as<double>(), mb_exception);
+	}
+
+	TEST(CsvCellReader, MissingCellThrows)
+	{
+		csv_cell_reader cells{ "1" };
+		cells.next_as<int>();
+
+		EXPECT_THROW(cells.next_as<int>(), mb_exception);
+	}
+
+	TEST(CsvCellReader, OhlcvLineMatchesOhlcvRow)
+	{
+		std::string_view line{ "1609459200,29000.5,29100,28900.25,29050,12.5" };
+
+		assert_ohlcv_data_eq(from_csv_row<ohlcv_data>(parse_row(line)), from_csv_line<ohlcv_data>(line));
+	}
+
+	TEST(CsvCellReader, ParsesNumbersWithLeadingSpaceAndPlusSign)
+	{
+		csv_cell_reader cells{ " 1, +2.5,\t-3,+-4" };
+
+		EXPECT_EQ(1, cells.next_as<int>());
+		EXPECT_DOUBLE_EQ(2.5, cells.next_as<double>());
+		EXPECT_DOUBLE_EQ(-3, cells.next_as<double>());
+		EXPECT_THROW(cells.next_as<double>(), mb_exception);
+	}
+
+	TEST(CsvCellReader, SpacedOhlcvLineMatchesOhlcvRow)
+	{
+		std::string_view line{ "1, 2.0, +3, 1.5 ,2.5, 10" };
+
+		assert_ohlcv_data_eq(from_csv_row<ohlcv_data>(parse_row(line)), from_csv_line<ohlcv_data>(line));
+		assert_ohlcv_data_eq(ohlcv_data{ 1, 2.0, 3, 1.5, 2.5, 10 }, from_csv_line<ohlcv_data>(line));
+	}
+
+	TEST(CsvCellReader, DISABLED_BenchmarkReadOhlcvRows)
+	{
+		constexpr int rowCount = 1000000;
+		std::filesystem::path path{ test_temp_directory() };
+		path += ".csv";
+
+		{
+			std::ofstream stream{ path };
+			for (int i = 0; i < rowCount; ++i)
+			{
+				stream << i * 60 << ",29000.5,29100,28900.25,29050,12.5\n";
+			}
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		stream_file(path, [](std::string_view line) { from_csv_row<ohlcv_data>(parse_row(line)); });
+		std::chrono::duration<double> rowTime{ std::chrono::steady_clock::now() - start };
+
+		start = std::chrono::steady_clock::now();
+		read_csv_file<ohlcv_data>(path);
+		std::chrono::duration<double> lineTime{ std::chrono::steady_clock::now() - start };
+
+		std::filesystem::remove(path);
+
+		std::cout << "Reading " << rowCount << " OHLCV rows\n"
+			<< "  csv_row:         " << static_cast<long long>(rowCount / rowTime.count()) << " rows/s\n"
+			<< "  csv_cell_reader: " << static_cast<long long>(rowCount / lineTime.count()) << " rows/s\n";
+	}
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+
+#include "common/security/hash.h"
+#include "common/security/encoding.h"
+#include "common/security/hmac_signer.h"
+
+namespace
+{
+	using namespace mb;
+
+	constexpr std::string_view SECRET = "NhqPtmdSJYdKjVHjA7PZj4Mge3R5YNiP1e3UZjInClVN65XAbvqqM6A7H5fATj0j";
+	constexpr std::string_view QUERY = "symbol=BTCUSDT&side=BUY&type=LIMIT&timeInForce=GTC&quantity=1&price=0.1&recvWindow=5000&timestamp=1499827319559";
+
+	long long time_per_call(int iterations, const std::function<void()>& call)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i)
+		{
+			call();
+		}
+
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count() / iterations;
+	}
+
+	void print_benchmark(std::string_view name, long long legacyTime, long long signerTime)
+	{
+		std::cout << name << "\n"
+			<< "  legacy: " << legacyTime << "ns\n"
+			<< "  signer: " << signerTime << "ns\n";
+	}
+}
+
+namespace mb::test
+{
+	TEST(HmacSigner, Sha256HexMatchesLegacyHmac)
+	{
+		hmac_signer signer{ create_hmac_sha256_signer(SECRET) };
+
+		EXPECT_EQ(hex_encode(hmac_sha256(QUERY, SECRET)), hex_encode(signer.sign(QUERY)).view());
+	}
+
+	TEST(HmacSigner, Sha512Base64MatchesLegacyHmac)
+	{
+		std::vector<unsigned char> key{ b64_decode(SECRET) };
+		hmac_signer signer{ create_hmac_sha512_signer(key) };
+
+		EXPECT_EQ(b64_encode(hmac_sha512(QUERY, key)), b64_encode(signer.sign(QUERY)).view());
+	}
+
+	TEST(HmacSigner, SigningPartsMatchesSigningConcatenation)
+	{
+		hmac_signer signer{ create_hmac_sha256_signer(SECRET) };
+
+		EXPECT_EQ(
+			hex_encode(signer.sign("1499827319559GET/orders?", QUERY)).view(),
+			hex_encode(signer.sign("1499827319559", "GET", "/orders", "?", QUERY)).view());
+	}
+
+	TEST(HmacSigner, RepeatedSigningIsStable)
+	{
+		hmac_signer signer{ create_hmac_sha256_signer(SECRET) };
+
+		std::string first{ hex_encode(signer.sign(QUERY)).to_string() };
+		signer.sign("a different message");
+
+		EXPECT_EQ(first, hex_encode(signer.sign(QUERY)).view());
+	}
+
+	TEST(HmacSigner, EmptyKeyMatchesLegacyHmac)
+	{
+		hmac_signer signer{ create_hmac_sha256_signer(std::string{}) };
+
+		EXPECT_EQ(hex_encode(hmac_sha256(QUERY, std::string{})), hex_encode(signer.sign(QUERY)).view());
+	}
+
+	TEST(HmacSigner, DISABLED_BenchmarkExchangeSigningPaths)
+	{
+		constexpr int iterations = 100000;
+
+		hmac_signer sha256Signer{ create_hmac_sha256_signer(SECRET) };
+
+		// Binance, Bybit and Digifinex sign the query string and hex encode it
+		print_benchmark("hmac_sha256 + hex (binance, bybit, digifinex)",
+			time_per_call(iterations, []() { hex_encode(hmac_sha256(QUERY, SECRET)); }),
+			time_per_call(iterations, [&sha256Signer]() { hex_encode(sha256Signer.sign(QUERY)).to_string(); }));
+
+		// Coinbase signs timestamp + verb + path + query + body and Base64 encodes it
+		std::vector<unsigned char> coinbaseKey{ b64_decode(SECRET) };
+		hmac_signer coinbaseSigner{ create_hmac_sha256_signer(coinbaseKey) };
+		std::string_view body = R"({"size":"0.01","price":"0.100","side":"buy","product_id":"BTC-USD"})";
+
+		print_benchmark("hmac_sha256 + base64 (coinbase)",
+			time_per_call(iterations, [&coinbaseKey, body]()
+			{
+				std::string message{ "1499827319" };
+				message.append("POST").append("/orders").append(body);
+				b64_encode(hmac_sha256(message, coinbaseKey));
+			}),
+			time_per_call(iterations, [&coinbaseSigner, body]() { b64_encode(coinbaseSigner.sign("1499827319", "POST", "/orders", body)).to_string(); }));
+
+		// Kraken signs the path followed by sha256(nonce + post data) with SHA-512 and Base64 encodes it
+		std::vector<unsigned char> krakenKey{ b64_decode(SECRET) };
+		hmac_signer krakenSigner{ create_hmac_sha512_signer(krakenKey) };
+		std::string_view path = "/0/private/AddOrder";
+		std::string_view nonce = "1616492376594";
+
+		print_benchmark("hmac_sha512 + base64 (kraken)",
+			time_per_call(iterations, [&krakenKey, path, nonce]()
+			{
+				std::vector<unsigned char> noncePostData = sha256(std::string{ nonce }.append(QUERY));
+				std::vector<unsigned char> message{ path.begin(), path.end() };
+				message.insert(message.end(), noncePostData.begin(), noncePostData.end());
+				b64_encode(hmac_sha512(message, krakenKey));
+			}),
+			time_per_call(iterations, [&krakenSigner, path, nonce]()
+			{
+				std::array<unsigned char, SHA256_DIGEST_LENGTH> noncePostData;
+				SHA256_CTX context;
+				SHA256_Init(&context);
+				SHA256_Update(&context, nonce.data(), nonce.size());
+				SHA256_Update(&context, QUERY.data(), QUERY.size());
+				SHA256_Final(noncePostData.data(), &context);
+
+				std::string_view noncePostDataView{ reinterpret_cast<const char*>(noncePostData.data()), noncePostData.size() };
+				b64_encode(krakenSigner.sign(path, noncePostDataView)).to_string();
+			}));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include "common/types/latency_histogram.h"
+
+namespace mb::test
+{
+	using namespace std::chrono_literals;
+
+	TEST(LatencyHistogram, EmptyHistogramReturnsZero)
+	{
+		latency_histogram histogram;
+
+		EXPECT_EQ(0, histogram.sample_count());
+		EXPECT_EQ(0us, histogram.percentile(50));
+		EXPECT_EQ(0us, histogram.max());
+	}
+
+	TEST(LatencyHistogram, RecordTracksLastAndMax)
+	{
+		latency_histogram histogram;
+
+		histogram.record(300us);
+		histogram.record(1000us);
+		histogram.record(20us);
+
+		EXPECT_EQ(3, histogram.sample_count());
+		EXPECT_EQ(20us, histogram.last());
+		EXPECT_EQ(1000us, histogram.max());
+	}
+
+	TEST(LatencyHistogram, PercentileIsWithinFactorOfTwo)
+	{
+		latency_histogram histogram;
+
+		for (int i = 0; i < 99; ++i)
+		{
+			histogram.record(100us);
+		}
+
+		histogram.record(50000us);
+
+		std::chrono::microseconds median{ histogram.percentile(50) };
+		EXPECT_GE(median, 100us);
+		EXPECT_LT(median, 200us);
+		EXPECT_EQ(50000us, histogram.percentile(100));
+	}
+
+	TEST(LatencyHistogram, PercentileDoesNotExceedMax)
+	{
+		latency_histogram histogram;
+
+		histogram.record(600us);
+
+		EXPECT_EQ(600us, histogram.percentile(99));
+	}
+}
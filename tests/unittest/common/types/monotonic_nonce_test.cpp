@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include <thread>
+
+#include "common/types/monotonic_nonce.h"
+
+namespace mb::test
+{
+	TEST(MonotonicNonce, ValuesAreMicrosecondTimestamps)
+	{
+		monotonic_nonce nonce;
+
+		long long before{ time_since_epoch<std::chrono::microseconds>() };
+		long long value{ nonce.next() };
+
+		EXPECT_GE(value, before);
+		EXPECT_LE(value, time_since_epoch<std::chrono::microseconds>() + 1);
+	}
+
+	TEST(MonotonicNonce, ValuesAreUniqueAndIncreasingAcrossThreads)
+	{
+		constexpr int threadCount = 8;
+		constexpr int valuesPerThread = 10000;
+
+		monotonic_nonce nonce;
+		std::vector<std::vector<long long>> values(threadCount);
+		std::vector<std::thread> threads;
+
+		for (int i = 0; i < threadCount; ++i)
+		{
+			threads.emplace_back([&nonce, &values, i]()
+			{
+				for (int j = 0; j < valuesPerThread; ++j)
+				{
+					values[i].push_back(nonce.next());
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		std::set<long long> distinctValues;
+		for (auto& threadValues : values)
+		{
+			EXPECT_EQ(threadValues.end(), std::adjacent_find(threadValues.begin(), threadValues.end(), std::greater_equal<long long>{}));
+			distinctValues.insert(threadValues.begin(), threadValues.end());
+		}
+
+		EXPECT_EQ(threadCount * valuesPerThread, distinctValues.size());
+	}
+}
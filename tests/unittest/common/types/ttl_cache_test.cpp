@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include "common/types/ttl_cache.h"
+
+namespace mb::test
+{
+	TEST(TtlCache, GetLoadsValueOnceWhileUnexpired)
+	{
+		ttl_cache<int, int> cache{ std::chrono::hours{ 1 } };
+		int loadCount = 0;
+
+		cache.get(1, [&loadCount]() { return ++loadCount; });
+
+		EXPECT_EQ(1, cache.get(1, [&loadCount]() { return ++loadCount; }));
+		EXPECT_EQ(1, loadCount);
+	}
+
+	TEST(TtlCache, ExpiredEntriesAreRemovedAsCacheGrows)
+	{
+		ttl_cache<int, int> cache{ std::chrono::milliseconds{ 0 } };
+
+		for (int i = 0; i < 1000; ++i)
+		{
+			cache.get(i, [i]() { return i; });
+		}
+
+		EXPECT_LE(cache.size(), 64);
+	}
+
+	TEST(TtlCache, UnexpiredEntriesAreKeptAsCacheGrows)
+	{
+		ttl_cache<int, int> cache{ std::chrono::hours{ 1 } };
+
+		for (int i = 0; i < 1000; ++i)
+		{
+			cache.put(i, i);
+		}
+
+		EXPECT_EQ(1000, cache.size());
+		EXPECT_EQ(0, cache.get(0, []() { return -1; }));
+	}
+}
\ No newline at end of file
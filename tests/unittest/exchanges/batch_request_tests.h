@@ -0,0 +1,99 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+
+#include "mbtest/mocks.h"
+#include "exchange_test_common.h"
+#include "exchanges/exchange.h"
+
+namespace mb::test
+{
+	template<typename Api>
+	class BatchRequestTests : public testing::Test
+	{
+	protected:
+		static constexpr int PAIR_COUNT = 20;
+		static constexpr std::chrono::milliseconds SIMULATED_LATENCY{ 20 };
+
+		mock_http_service* _mockHttpService;
+		std::unique_ptr<exchange> _api;
+		std::vector<tradable_pair> _pairs;
+		int _requestCount;
+
+		BatchRequestTests()
+			: _mockHttpService{ nullptr }, _api{}, _pairs{}, _requestCount{ 0 }
+		{
+			_pairs.push_back(get_testing_pair<Api>());
+			_pairs.push_back(get_testing_pair_2<Api>());
+		}
+
+		void SetUp() override
+		{
+			std::unique_ptr<mock_http_service> mockHttpService{ std::make_unique<mock_http_service>() };
+
+			_mockHttpService = mockHttpService.get();
+			_api = create_exchange_api<Api>(std::move(mockHttpService), nullptr);
+		}
+
+		void set_http_response(std::string_view fileName, std::chrono::milliseconds latency = std::chrono::milliseconds{ 0 })
+		{
+			http_response response{ 200, read_response_file(_api->id(), fileName) };
+
+			EXPECT_CALL(*_mockHttpService, send(testing::_))
+				.WillRepeatedly(testing::Invoke([this, response, latency](const http_request&)
+				{
+					++_requestCount;
+					std::this_thread::sleep_for(latency);
+
+					return response;
+				}));
+		}
+	};
+
+	TYPED_TEST_SUITE_P(BatchRequestTests);
+
+	TYPED_TEST_P(BatchRequestTests, GetPricesSendsSingleRequest)
+	{
+		this->set_http_response("get_prices");
+
+		std::unordered_map<tradable_pair, double> prices{ this->_api->get_prices(this->_pairs) };
+
+		EXPECT_EQ(1, this->_requestCount);
+		EXPECT_EQ(this->_pairs.size(), prices.size());
+	}
+
+	// Compares the per-pair fallback in market_api against the exchange's batch endpoint
+	TYPED_TEST_P(BatchRequestTests, DISABLED_BenchmarkGetPrices)
+	{
+		std::vector<tradable_pair> pairs;
+		for (int i = 0; i < this->PAIR_COUNT; ++i)
+		{
+			pairs.push_back(this->_pairs[i % this->_pairs.size()]);
+		}
+
+		this->set_http_response("get_price", this->SIMULATED_LATENCY);
+
+		auto start = std::chrono::steady_clock::now();
+		this->_api->market_api::get_prices(pairs);
+		auto perPairTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+		int perPairRequests = this->_requestCount;
+
+		testing::Mock::VerifyAndClearExpectations(this->_mockHttpService);
+		this->_requestCount = 0;
+		this->set_http_response("get_prices", this->SIMULATED_LATENCY);
+
+		start = std::chrono::steady_clock::now();
+		this->_api->get_prices(pairs);
+		auto batchTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+		std::cout << this->_api->id() << " get_prices for " << pairs.size() << " pairs\n"
+			<< "  per pair: " << perPairRequests << " requests, " << perPairTime.count() << "ms\n"
+			<< "  batch:    " << this->_requestCount << " requests, " << batchTime.count() << "ms\n";
+	}
+
+	REGISTER_TYPED_TEST_SUITE_P(BatchRequestTests,
+		GetPricesSendsSingleRequest,
+		DISABLED_BenchmarkGetPrices);
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "exchanges/cached_exchange.h"
+#include "exchanges/binance/binance.h"
+#include "common/file/config_file_reader.h"
+#include "mbtest/mocks.h"
+#include "mbtest/temp_directory.h"
+
+namespace mb::test
+{
+	using testing::Return;
+	using testing::Throw;
+	using testing::HasSubstr;
+	using testing::Property;
+	using testing::_;
+
+	TEST(CachedExchange, RepeatedStatusCallsHitExchangeOnce)
+	{
+		auto mockExchange = std::make_unique<mock_exchange>();
+		EXPECT_CALL(*mockExchange, get_status())
+			.Times(1)
+			.WillOnce(Return(exchange_status::ONLINE));
+
+		cached_exchange exchange{ std::move(mockExchange) };
+
+		EXPECT_EQ(exchange_status::ONLINE, exchange.get_status());
+		EXPECT_EQ(exchange_status::ONLINE, exchange.get_status());
+	}
+
+	TEST(CachedExchange, ExpiredEntriesAreReloaded)
+	{
+		auto mockExchange = std::make_unique<mock_exchange>();
+		EXPECT_CALL(*mockExchange, get_status())
+			.Times(2)
+			.WillRepeatedly(Return(exchange_status::ONLINE));
+
+		response_cache_ttls ttls;
+		ttls.status = std::chrono::milliseconds{ 0 };
+
+		cached_exchange exchange{ std::move(mockExchange), {}, ttls };
+
+		exchange.get_status();
+		exchange.get_status();
+	}
+
+	TEST(CachedExchange, FeesAreCachedPerPair)
+	{
+		tradable_pair first{ "BTC", "GBP" };
+		tradable_pair second{ "ETH", "GBP" };
+
+		auto mockExchange = std::make_unique<mock_exchange>();
+		EXPECT_CALL(*mockExchange, get_fee(first)).Times(1).WillOnce(Return(0.1));
+		EXPECT_CALL(*mockExchange, get_fee(second)).Times(1).WillOnce(Return(0.2));
+
+		cached_exchange exchange{ std::move(mockExchange) };
+
+		EXPECT_DOUBLE_EQ(0.1, exchange.get_fee(first));
+		EXPECT_DOUBLE_EQ(0.2, exchange.get_fee(second));
+		EXPECT_DOUBLE_EQ(0.1, exchange.get_fee(first));
+	}
+
+	TEST(CachedExchange, FailedCallsAreNotCached)
+	{
+		auto mockExchange = std::make_unique<mock_exchange>();
+		EXPECT_CALL(*mockExchange, get_status())
+			.WillOnce(Throw(std::runtime_error{ "timeout" }))
+			.WillOnce(Return(exchange_status::ONLINE));
+
+		cached_exchange exchange{ std::move(mockExchange) };
+
+		EXPECT_THROW(exchange.get_status(), std::runtime_error);
+		EXPECT_EQ(exchange_status::ONLINE, exchange.get_status());
+	}
+
+	TEST(CachedExchange, ConcurrentRequestsShareOneCall)
+	{
+		auto mockExchange = std::make_unique<mock_exchange>();
+		EXPECT_CALL(*mockExchange, get_tradable_pairs())
+			.Times(1)
+			.WillOnce([]()
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+				return std::vector<tradable_pair>{ tradable_pair{ "BTC", "GBP" } };
+			});
+
+		cached_exchange exchange{ std::move(mockExchange) };
+
+		std::vector<std::thread> threads;
+		for (int i = 0; i < 4; ++i)
+		{
+			threads.emplace_back([&exchange]() { EXPECT_EQ(1, exchange.get_tradable_pairs().size()); });
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+	}
+
+	TEST(CachedExchange, WarmCacheSurvivesRestart)
+	{
+		std::filesystem::path directory{ test_temp_directory() };
+		std::filesystem::remove_all(directory);
+
+		std::vector<tradable_pair> pairs{ tradable_pair{ "BTC", "GBP" }, tradable_pair{ "ETH", "USD" } };
+
+		{
+			auto mockExchange = std::make_unique<mock_exchange>();
+			EXPECT_CALL(*mockExchange, get_tradable_pairs()).Times(1).WillOnce(Return(pairs));
+
+			cached_exchange exchange{ std::move(mockExchange), directory };
+			exchange.get_tradable_pairs();
+		}
+
+		auto mockExchange = std::make_unique<mock_exchange>();
+		EXPECT_CALL(*mockExchange, get_tradable_pairs()).Times(0);
+
+		cached_exchange exchange{ std::move(mockExchange), directory };
+
+		EXPECT_EQ(pairs, exchange.get_tradable_pairs());
+
+		std::filesystem::remove_all(directory);
+	}
+
+	TEST(CachedExchange, PricesAreNotCached)
+	{
+		tradable_pair pair{ "BTC", "GBP" };
+
+		auto mockExchange = std::make_unique<mock_exchange>();
+		EXPECT_CALL(*mockExchange, get_price(pair)).Times(2).WillRepeatedly(Return(100.0));
+
+		cached_exchange exchange{ std::move(mockExchange) };
+
+		exchange.get_price(pair);
+		exchange.get_price(pair);
+	}
+
+	TEST(CachedExchange, BinanceOrderAfterWarmStartUsesPairFilters)
+	{
+		std::filesystem::path directory{ test_temp_directory() };
+		std::filesystem::remove_all(directory);
+
+		http_response exchangeInfo{ 200, R"({"symbols":[{"baseAsset":"BTC","quoteAsset":"USDT","filters":[
+			{"filterType":"PRICE_FILTER","tickSize":"1.00000000"},
+			{"filterType":"LOT_SIZE","minQty":"0.10000000","stepSize":"0.10000000"}]}]})" };
+
+		auto create_cached_binance = [&directory, &exchangeInfo](int exchangeInfoCalls)
+		{
+			auto mockHttpService = std::make_unique<mock_http_service>();
+
+			EXPECT_CALL(*mockHttpService, send(Property(&http_request::url, HasSubstr("/api/v3/exchangeInfo"))))
+				.Times(exchangeInfoCalls)
+				.WillRepeatedly(Return(exchangeInfo));
+
+			EXPECT_CALL(*mockHttpService, send(Property(&http_request::url, HasSubstr("/api/v3/order"))))
+				.WillRepeatedly([](const http_request& request)
+				{
+					EXPECT_THAT(request.url(), HasSubstr("quantity=0.1&"));
+					EXPECT_THAT(request.url(), HasSubstr("price=20000&"));
+					return http_response{ 200, R"({"orderId":1})" };
+				});
+
+			return cached_exchange
+			{
+				std::make_unique<binance_api>(internal::load_or_create_config<binance_config>(), std::move(mockHttpService), nullptr),
+				directory
+			};
+		};
+
+		create_cached_binance(1).get_tradable_pairs();
+
+		// The pairs now come from disk, so placing an order has to fetch the filters itself
+		cached_exchange exchange{ create_cached_binance(1) };
+		exchange.get_tradable_pairs();
+		exchange.add_order(create_limit_order(tradable_pair{ "BTC", "USDT" }, trade_action::BUY, 20000.4, 0.12));
+
+		std::filesystem::remove_all(directory);
+	}
+}
\ No newline at end of file
@@ -40,7 +40,15 @@ namespace mb::test
 			http_response response{ 200, std::move(responseMessage) };
 
 			EXPECT_CALL(*_mockHttpService, send(_))
-				.WillRepeatedly(Return(std::move(response)));
+				.WillRepeatedly(Return(response));
+
+			EXPECT_CALL(*_mockHttpService, send_async(_))
+				.WillRepeatedly(testing::Invoke([response](const http_request&)
+				{
+					std::promise<http_response> result;
+					result.set_value(response);
+					return result.get_future();
+				}));
 		}
 	};
 
@@ -105,6 +113,17 @@ namespace mb::test
 		ASSERT_DOUBLE_EQ(20137.2, price);
 	}
 
+	TYPED_TEST_P(ExchangeReaderTests, ReadPrices)
+	{
+		tradable_pair secondPair{ get_testing_pair_2<TypeParam>() };
+
+		this->set_http_response("get_prices");
+		std::unordered_map<tradable_pair, double> prices{ this->_api->get_prices({ this->_testingPair, secondPair }) };
+
+		ASSERT_EQ(2, prices.size());
+		ASSERT_DOUBLE_EQ(20137.2, prices.at(this->_testingPair));
+	}
+
 	TYPED_TEST_P(ExchangeReaderTests, ReadOrderBook)
 	{
 		order_book_state expectedOrderBook
@@ -200,6 +219,7 @@ namespace mb::test
 		ReadTradablePairs,
 		ReadOhlcv,
 		ReadPrice,
+		ReadPrices,
 		ReadOrderBook,
 		ReadFee,
 		ReadBalances,
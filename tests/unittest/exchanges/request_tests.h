@@ -102,8 +102,16 @@ namespace mb::test
 			std::string responseFile{ read_response_file(_api->id(), fileName) };
 			http_response response{ 200, std::move(responseFile) };
 
-			EXPECT_CALL(*_mockHttpService, send(IsHttpRequest(std::move(expectedRequest))))
-				.WillRepeatedly(Return(std::move(response)));
+			EXPECT_CALL(*_mockHttpService, send(IsHttpRequest(expectedRequest)))
+				.WillRepeatedly(Return(response));
+
+			EXPECT_CALL(*_mockHttpService, send_async(IsHttpRequest(std::move(expectedRequest))))
+				.WillRepeatedly(testing::Invoke([response](const http_request&)
+				{
+					std::promise<http_response> result;
+					result.set_value(response);
+					return result.get_future();
+				}));
 		}
 	};
 
@@ -133,12 +141,24 @@ namespace mb::test
 		this->_api->get_price(tradable_pair{ "BTC", "USD" });
 	}
 
+	TYPED_TEST_P(ExchangeRequestTests, GetPrices)
+	{
+		this->set_http_service_behaviour("get_prices");
+		this->_api->get_prices(std::vector<tradable_pair>{ tradable_pair{ "BTC", "USD" } });
+	}
+
 	TYPED_TEST_P(ExchangeRequestTests, GetOrderBook)
 	{
 		this->set_http_service_behaviour("get_order_book");
 		this->_api->get_order_book(tradable_pair{ "BTC", "USD" }, 5);
 	}
 
+	TYPED_TEST_P(ExchangeRequestTests, GetOrderBooks)
+	{
+		this->set_http_service_behaviour("get_order_book");
+		this->_api->get_order_books(std::vector<tradable_pair>{ tradable_pair{ "BTC", "USD" } }, 5);
+	}
+
 	TYPED_TEST_P(ExchangeRequestTests, GetFee)
 	{
 		this->set_http_service_behaviour("get_fee");
@@ -184,7 +204,9 @@ namespace mb::test
 		GetTradablePairs,
 		GetOhlcv,
 		GetPrice,
+		GetPrices,
 		GetOrderBook,
+		GetOrderBooks,
 		GetFee,
 		GetBalances,
 		GetOpenOrders,
@@ -3,6 +3,7 @@
 #include "unittest/exchanges/integration_tests.h"
 #include "unittest/exchanges/reader_tests.h"
 #include "unittest/exchanges/request_tests.h"
+#include "unittest/exchanges/batch_request_tests.h"
 #include "unittest/exchanges/websocket_stream_tests.h"
 
 namespace mb::test
@@ -38,5 +39,6 @@ namespace mb::test
 	INSTANTIATE_TYPED_TEST_SUITE_P(Binance, ExchangeIntegrationTests, binance_api);
 	INSTANTIATE_TYPED_TEST_SUITE_P(Binance, ExchangeReaderTests, binance_api);
 	INSTANTIATE_TYPED_TEST_SUITE_P(Binance, ExchangeRequestTests, binance_api);
+	INSTANTIATE_TYPED_TEST_SUITE_P(Binance, BatchRequestTests, binance_api);
 	INSTANTIATE_TYPED_TEST_SUITE_P(Binance, WebsocketStreamTests, internal::binance_websocket_stream);
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "unittest/exchanges/integration_tests.h"
 #include "unittest/exchanges/reader_tests.h"
 #include "unittest/exchanges/request_tests.h"
+#include "unittest/exchanges/batch_request_tests.h"
 #include "unittest/exchanges/websocket_stream_tests.h"
 
 namespace mb::test
@@ -30,5 +31,6 @@ namespace mb::test
 	INSTANTIATE_TYPED_TEST_SUITE_P(ByBit, ExchangeIntegrationTests, bybit_api);
 	INSTANTIATE_TYPED_TEST_SUITE_P(ByBit, ExchangeReaderTests, bybit_api);
 	INSTANTIATE_TYPED_TEST_SUITE_P(ByBit, ExchangeRequestTests, bybit_api);
+	INSTANTIATE_TYPED_TEST_SUITE_P(ByBit, BatchRequestTests, bybit_api);
 	INSTANTIATE_TYPED_TEST_SUITE_P(ByBit, WebsocketStreamTests, internal::bybit_websocket_stream);
 }
\ No newline at end of file
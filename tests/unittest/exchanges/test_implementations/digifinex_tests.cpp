@@ -3,6 +3,7 @@
 #include "unittest/exchanges/integration_tests.h"
 #include "unittest/exchanges/reader_tests.h"
 #include "unittest/exchanges/request_tests.h"
+#include "unittest/exchanges/batch_request_tests.h"
 #include "unittest/exchanges/websocket_stream_tests.h"
 
 namespace mb::test
@@ -41,5 +42,6 @@ namespace mb::test
 	INSTANTIATE_TYPED_TEST_SUITE_P(Digifinex, ExchangeIntegrationTests, digifinex_api);
 	INSTANTIATE_TYPED_TEST_SUITE_P(Digifinex, ExchangeReaderTests, digifinex_api);
 	INSTANTIATE_TYPED_TEST_SUITE_P(Digifinex, ExchangeRequestTests, digifinex_api);
+	INSTANTIATE_TYPED_TEST_SUITE_P(Digifinex, BatchRequestTests, digifinex_api);
 	INSTANTIATE_TYPED_TEST_SUITE_P(Digifinex, WebsocketStreamTests, internal::digifinex_websocket_stream);
 }
\ No newline at end of file
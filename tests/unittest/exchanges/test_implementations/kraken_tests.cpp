@@ -3,6 +3,7 @@
 #include "unittest/exchanges/integration_tests.h"
 #include "unittest/exchanges/reader_tests.h"
 #include "unittest/exchanges/request_tests.h"
+#include "unittest/exchanges/batch_request_tests.h"
 #include "unittest/exchanges/websocket_stream_tests.h"
 
 namespace mb::test
@@ -30,5 +31,6 @@ namespace mb::test
 	INSTANTIATE_TYPED_TEST_SUITE_P(Kraken, ExchangeIntegrationTests, kraken_api);
 	INSTANTIATE_TYPED_TEST_SUITE_P(Kraken, ExchangeReaderTests, kraken_api);
 	INSTANTIATE_TYPED_TEST_SUITE_P(Kraken, ExchangeRequestTests, kraken_api);
+	INSTANTIATE_TYPED_TEST_SUITE_P(Kraken, BatchRequestTests, kraken_api);
 	INSTANTIATE_TYPED_TEST_SUITE_P(Kraken, WebsocketStreamTests, internal::kraken_websocket_stream);
 }
\ No newline at end of file
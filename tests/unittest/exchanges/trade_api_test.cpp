@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "mbtest/mocks.h"
+
+namespace mb::test
+{
+	using namespace std::chrono_literals;
+	using testing::_;
+	using testing::Invoke;
+	using testing::Throw;
+
+	TEST(TradeApi, AddOrdersAsyncSubmitsLegsConcurrently)
+	{
+		constexpr auto roundTrip = 100ms;
+
+		mock_exchange exchange;
+		EXPECT_CALL(exchange, add_order(_))
+			.Times(3)
+			.WillRepeatedly(Invoke([roundTrip](const order_request& request)
+			{
+				std::this_thread::sleep_for(roundTrip);
+				return request.pair().to_string();
+			}));
+
+		std::vector<order_request> legs
+		{
+			create_market_order(tradable_pair{ "BTC", "GBP" }, trade_action::BUY, 1.0),
+			create_market_order(tradable_pair{ "ETH", "BTC" }, trade_action::BUY, 1.0),
+			create_market_order(tradable_pair{ "ETH", "GBP" }, trade_action::SELL, 1.0)
+		};
+
+		auto start = std::chrono::steady_clock::now();
+		std::vector<std::future<std::string>> orderIds{ exchange.add_orders_async(legs) };
+
+		for (int i = 0; i < legs.size(); ++i)
+		{
+			EXPECT_EQ(legs[i].pair().to_string(), orderIds[i].get());
+		}
+
+		EXPECT_LT(std::chrono::steady_clock::now() - start, roundTrip * legs.size());
+	}
+
+	TEST(TradeApi, CancelOrderAsyncStoresErrorInFuture)
+	{
+		mock_exchange exchange;
+		EXPECT_CALL(exchange, cancel_order(std::string_view{ "1234" }))
+			.WillOnce(Throw(std::runtime_error{ "unknown order" }));
+
+		EXPECT_THROW(exchange.cancel_order_async("1234").get(), std::runtime_error);
+	}
+}
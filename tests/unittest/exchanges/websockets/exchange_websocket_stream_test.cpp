@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "exchanges/websockets/exchange_websocket_stream.h"
+#include "common/exceptions/mb_exception.h"
 #include "mbtest/mocks.h"
 #include "mbtest/assertion_helpers.h"
 
@@ -244,6 +245,96 @@ namespace mb::test
 		ASSERT_TRUE(eventFired);
 	}
 
+	TEST(ExchangeWebsocketStream, UpdateTradeHandlerReceivesSubscribedPair)
+	{
+		tradable_pair pair{ "test", "test" };
+		mock_exchange_websocket_stream test{ create_mock_stream() };
+
+		std::vector<const tradable_pair*> receivedPairs;
+		test.add_trade_update_handler([&receivedPairs](trade_update_message message) { receivedPairs.push_back(&message.pair()); });
+
+		test.subscribe(websocket_subscription::create_trade_sub({ pair }));
+		test.expose_update_trade(pair.to_string(), trade_update{ 1, 2.0, 3.0 });
+		test.expose_update_trade(pair.to_string(), trade_update{ 2, 2.0, 3.0 });
+
+		ASSERT_EQ(2, receivedPairs.size());
+		EXPECT_EQ(pair, *receivedPairs[0]);
+		EXPECT_EQ(receivedPairs[0], receivedPairs[1]);
+	}
+
+	TEST(ExchangeWebsocketStream, UpdatesForUnsubscribedPairsAreNotPassedToHandlers)
+	{
+		tradable_pair pair{ "test", "test" };
+		mock_exchange_websocket_stream test{ create_mock_stream() };
+
+		int eventCount = 0;
+		test.add_trade_update_handler([&eventCount](trade_update_message) { ++eventCount; });
+		test.add_order_book_update_handler([&eventCount](order_book_update_message) { ++eventCount; });
+
+		ASSERT_NO_THROW(test.expose_update_trade(pair.to_string(), trade_update{ 1, 2.0, 3.0 }));
+		ASSERT_NO_THROW(test.expose_update_order_book(pair.to_string(), 1, order_book_entry{ 1.0, 2.0, order_book_side::ASK }));
+
+		EXPECT_EQ(0, eventCount);
+	}
+
+	TEST(ExchangeWebsocketStream, UpdateTradeAddsToTradeHistory)
+	{
+		tradable_pair pair{ "test", "test" };
+		mock_exchange_websocket_stream test{ create_mock_stream() };
+
+		test.subscribe(websocket_subscription::create_trade_sub({ pair }));
+		test.expose_update_trade(pair.to_string(), trade_update{ 1, 2.0, 3.0 });
+		test.expose_update_trade(pair.to_string(), trade_update{ 2, 4.0, 5.0 });
+
+		std::vector<trade_update> trades{ test.get_recent_trades(pair) };
+
+		ASSERT_EQ(2, trades.size());
+		assert_trade_update_eq(trade_update{ 2, 4.0, 5.0 }, trades[0]);
+		assert_trade_update_eq(trade_update{ 1, 2.0, 3.0 }, trades[1]);
+	}
+
+	TEST(ExchangeWebsocketStream, GetRecentTradesReturnsEmptyVectorIfNotSubscribed)
+	{
+		tradable_pair pair{ "test", "test" };
+		mock_exchange_websocket_stream test{ create_mock_stream() };
+
+		test.expose_update_trade(pair.to_string(), trade_update{ 1, 2.0, 3.0 });
+
+		EXPECT_TRUE(test.get_recent_trades(pair).empty());
+	}
+
+	TEST(ExchangeWebsocketStream, GetRecentTradesThrowsOnNegativeCount)
+	{
+		tradable_pair pair{ "test", "test" };
+		mock_exchange_websocket_stream test{ create_mock_stream() };
+
+		test.subscribe(websocket_subscription::create_trade_sub({ pair }));
+
+		EXPECT_THROW(test.get_recent_trades(pair, -1), mb_exception);
+	}
+
+	TEST(ExchangeWebsocketStream, GetMessageAgeIsMaxBeforeFirstMessage)
+	{
+		tradable_pair pair{ "test", "test" };
+		mock_exchange_websocket_stream test{ create_mock_stream() };
+
+		test.subscribe(websocket_subscription::create_trade_sub({ pair }));
+
+		EXPECT_EQ(std::chrono::milliseconds::max(), test.get_message_age(unique_websocket_subscription::create_trade_sub(pair)));
+	}
+
+	TEST(ExchangeWebsocketStream, UpdateTradeResetsMessageAgeForTradeChannelOnly)
+	{
+		tradable_pair pair{ "test", "test" };
+		mock_exchange_websocket_stream test{ create_mock_stream() };
+
+		test.subscribe(websocket_subscription::create_trade_sub({ pair }));
+		test.expose_update_trade(pair.to_string(), trade_update{ 1, 2.0, 3.0 });
+
+		EXPECT_LT(test.get_message_age(unique_websocket_subscription::create_trade_sub(pair)), std::chrono::seconds{ 1 });
+		EXPECT_EQ(std::chrono::milliseconds::max(), test.get_message_age(unique_websocket_subscription::create_order_book_sub(pair)));
+	}
+
 	TEST(ExchangeWebsocketStream, DoesNotCrashIfEventHandlerNotSet)
 	{
 		tradable_pair pair{ "test", "test" };
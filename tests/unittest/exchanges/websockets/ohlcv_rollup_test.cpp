@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include "exchanges/websockets/ohlcv_rollup.h"
+#include "mbtest/assertion_helpers.h"
+
+namespace mb::test
+{
+	namespace
+	{
+		struct emitted_update
+		{
+			ohlcv_interval interval;
+			ohlcv_data ohlcv;
+		};
+
+		std::vector<emitted_update> add_trade(ohlcv_rollup& rollup, std::time_t time, double price, double volume)
+		{
+			std::vector<emitted_update> updates;
+			rollup.add_trade(time, price, volume, [&updates](ohlcv_interval interval, const ohlcv_data& ohlcv)
+			{
+				updates.push_back(emitted_update{ interval, ohlcv });
+			});
+
+			return updates;
+		}
+	}
+
+	TEST(OhlcvRollup, AddTradeUpdatesAllSubscribedIntervals)
+	{
+		ohlcv_rollup rollup;
+		rollup.add_interval(ohlcv_interval::M1, ohlcv_data{ 600, 2, 4, 1, 3, 1 });
+		rollup.add_interval(ohlcv_interval::M5, ohlcv_data{ 600, 2, 4, 1, 3, 1 });
+		rollup.add_interval(ohlcv_interval::M15, ohlcv_data{ 0, 1, 5, 1, 3, 4 });
+
+		std::vector<emitted_update> updates{ add_trade(rollup, 610, 6, 0.5) };
+
+		ASSERT_EQ(3, updates.size());
+		assert_ohlcv_data_eq(ohlcv_data{ 600, 2, 6, 1, 6, 1.5 }, updates[0].ohlcv);
+		assert_ohlcv_data_eq(ohlcv_data{ 600, 2, 6, 1, 6, 1.5 }, updates[1].ohlcv);
+		assert_ohlcv_data_eq(ohlcv_data{ 0, 1, 6, 1, 6, 4.5 }, updates[2].ohlcv);
+	}
+
+	TEST(OhlcvRollup, CoarserIntervalsAreDerivedFromFinishedCandles)
+	{
+		ohlcv_rollup rollup;
+		rollup.add_interval(ohlcv_interval::M5, ohlcv_data{});
+
+		add_trade(rollup, 300, 10, 1);
+		add_trade(rollup, 330, 12, 1);
+		add_trade(rollup, 420, 8, 1);
+		add_trade(rollup, 599, 9, 1);
+
+		assert_ohlcv_data_eq(ohlcv_data{ 300, 10, 12, 8, 9, 4 }, rollup.get_ohlcv(ohlcv_interval::M5));
+	}
+
+	TEST(OhlcvRollup, NewWindowOpensAtPreviousClose)
+	{
+		ohlcv_rollup rollup;
+		rollup.add_interval(ohlcv_interval::M1, ohlcv_data{ 60, 2, 4, 1, 3, 1 });
+
+		std::vector<emitted_update> updates{ add_trade(rollup, 150, 5, 1) };
+
+		ASSERT_EQ(1, updates.size());
+		assert_ohlcv_data_eq(ohlcv_data{ 120, 3, 5, 3, 5, 1 }, updates[0].ohlcv);
+	}
+
+	TEST(OhlcvRollup, AddTradeOnlyEmitsChangedIntervals)
+	{
+		ohlcv_rollup rollup;
+		rollup.add_interval(ohlcv_interval::M1, ohlcv_data{ 60, 3, 3, 3, 3, 0 });
+		rollup.add_interval(ohlcv_interval::H1, ohlcv_data{ 0, 3, 3, 3, 3, 1 });
+
+		std::vector<emitted_update> updates{ add_trade(rollup, 70, 3, 0) };
+
+		EXPECT_TRUE(updates.empty());
+	}
+
+	TEST(OhlcvRollup, AddTradeIgnoresTradesBeforeCurrentCandle)
+	{
+		ohlcv_rollup rollup;
+		rollup.add_interval(ohlcv_interval::M1, ohlcv_data{ 60, 2, 4, 1, 3, 1 });
+
+		std::vector<emitted_update> updates{ add_trade(rollup, 30, 10, 1) };
+
+		EXPECT_TRUE(updates.empty());
+		assert_ohlcv_data_eq(ohlcv_data{ 60, 2, 4, 1, 3, 1 }, rollup.get_ohlcv(ohlcv_interval::M1));
+	}
+
+	TEST(OhlcvRollup, AddIntervalDoesNotDoubleCountExistingTrades)
+	{
+		ohlcv_rollup rollup;
+		rollup.add_interval(ohlcv_interval::M1, ohlcv_data{});
+
+		add_trade(rollup, 0, 1, 1);
+		add_trade(rollup, 61, 2, 1);
+
+		rollup.add_interval(ohlcv_interval::M5, ohlcv_data{ 0, 1, 2, 1, 2, 2 });
+		add_trade(rollup, 122, 3, 1);
+
+		assert_ohlcv_data_eq(ohlcv_data{ 120, 2, 3, 2, 3, 1 }, rollup.get_ohlcv(ohlcv_interval::M1));
+		assert_ohlcv_data_eq(ohlcv_data{ 0, 1, 3, 1, 3, 3 }, rollup.get_ohlcv(ohlcv_interval::M5));
+	}
+
+	TEST(OhlcvRollup, RemoveIntervalKeepsCoarserIntervals)
+	{
+		ohlcv_rollup rollup;
+		rollup.add_interval(ohlcv_interval::M1, ohlcv_data{});
+		rollup.add_interval(ohlcv_interval::M15, ohlcv_data{});
+
+		add_trade(rollup, 0, 1, 1);
+		add_trade(rollup, 61, 2, 1);
+
+		rollup.remove_interval(ohlcv_interval::M1);
+		add_trade(rollup, 122, 3, 1);
+
+		EXPECT_FALSE(rollup.is_subscribed(ohlcv_interval::M1));
+		EXPECT_FALSE(rollup.empty());
+		assert_ohlcv_data_eq(ohlcv_data{ 0, 1, 3, 1, 3, 3 }, rollup.get_ohlcv(ohlcv_interval::M15));
+	}
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <set>
+#include <thread>
+
+#include "networking/http/http_connection_pool.h"
+
+namespace mb::test
+{
+	TEST(HttpConnectionPool, ReleasedHandleIsReused)
+	{
+		http_connection_pool& pool{ http_connection_pool::instance() };
+
+		CURL* first;
+		{
+			http_connection_pool::pooled_handle handle{ pool.acquire() };
+			ASSERT_NE(nullptr, handle.get());
+
+			first = handle.get();
+		}
+
+		http_connection_pool::pooled_handle handle{ pool.acquire() };
+		EXPECT_EQ(first, handle.get());
+	}
+
+	TEST(HttpConnectionPool, ConcurrentCheckoutsReceiveDistinctHandles)
+	{
+		http_connection_pool& pool{ http_connection_pool::instance() };
+
+		constexpr int threadCount = 8;
+		std::vector<http_connection_pool::pooled_handle> handles(threadCount);
+		std::vector<std::thread> threads;
+
+		for (int i = 0; i < threadCount; ++i)
+		{
+			threads.emplace_back([&pool, &handles, i]() { handles[i] = pool.acquire(); });
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		std::set<CURL*> distinctHandles;
+		for (auto& handle : handles)
+		{
+			distinctHandles.insert(handle.get());
+		}
+
+		EXPECT_EQ(threadCount, distinctHandles.size());
+	}
+
+	TEST(HttpConnectionPool, ReleasedHandlesReturnToIdleList)
+	{
+		http_connection_pool& pool{ http_connection_pool::instance() };
+
+		http_connection_pool::pooled_handle first{ pool.acquire() };
+		http_connection_pool::pooled_handle second{ pool.acquire() };
+		int idleCount{ pool.idle_count() };
+
+		first.reset();
+		second.reset();
+
+		EXPECT_EQ(idleCount + 2, pool.idle_count());
+	}
+}
\ No newline at end of file
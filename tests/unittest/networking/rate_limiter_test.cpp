@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "networking/http/rate_limiter.h"
+
+namespace mb::test
+{
+	using namespace std::chrono_literals;
+
+	TEST(RateLimiter, AcquiresWithinCapacity)
+	{
+		rate_limiter limiter{ rate_limit{ 10, 0 } };
+
+		EXPECT_TRUE(limiter.try_acquire(5));
+		EXPECT_TRUE(limiter.try_acquire(4));
+	}
+
+	TEST(RateLimiter, NormalRequestsCannotUseOrderReserve)
+	{
+		rate_limiter limiter{ rate_limit{ 10, 0 } };
+
+		EXPECT_TRUE(limiter.try_acquire(9));
+		EXPECT_FALSE(limiter.try_acquire(1));
+		EXPECT_TRUE(limiter.try_acquire(1, request_priority::ORDER));
+	}
+
+	TEST(RateLimiter, UsedWeightHeaderReducesRemainingBudget)
+	{
+		rate_limiter limiter{ rate_limit{ 100, 0, "X-Used-Weight" } };
+
+		limiter.record_response(http_response{ 200, "", { http_header{ "x-used-weight", "95" } } });
+
+		EXPECT_DOUBLE_EQ(5, limiter.remaining());
+		EXPECT_FALSE(limiter.try_acquire(1));
+	}
+
+	TEST(RateLimiter, TooManyRequestsBlocksForRetryAfter)
+	{
+		rate_limiter limiter{ rate_limit{ 100, 1000 } };
+
+		limiter.record_response(http_response{ 429, "", { http_header{ "Retry-After", "10" } } });
+
+		EXPECT_FALSE(limiter.try_acquire(1, request_priority::ORDER));
+	}
+
+	TEST(RateLimiter, LimitExceededErrorBlocksRequests)
+	{
+		rate_limiter limiter{ rate_limit{ 10, 0.1, "", "Rate limit exceeded" } };
+
+		limiter.record_response(http_response{ 200, R"({"error":["EAPI:Rate limit exceeded"]})" });
+
+		EXPECT_FALSE(limiter.try_acquire(1, request_priority::ORDER));
+	}
+
+	TEST(RateLimiter, AcquireWaitsForRefill)
+	{
+		rate_limiter limiter{ rate_limit{ 10, 200 } };
+		limiter.try_acquire(9);
+
+		auto start = std::chrono::steady_clock::now();
+		limiter.acquire(4);
+
+		EXPECT_GE(std::chrono::steady_clock::now() - start, 15ms);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include "networking/http/response_buffer_pool.h"
+#include "networking/http/http_response.h"
+
+namespace mb::test
+{
+	TEST(ResponseBufferPool, ReleasedBufferIsReusedWithCapacity)
+	{
+		response_buffer_pool& pool{ response_buffer_pool::instance() };
+
+		const std::string* address;
+		{
+			std::shared_ptr<std::string> buffer{ pool.acquire() };
+			buffer->assign(4096, 'x');
+
+			address = buffer.get();
+		}
+
+		std::shared_ptr<std::string> buffer{ pool.acquire() };
+
+		EXPECT_EQ(address, buffer.get());
+		EXPECT_TRUE(buffer->empty());
+		EXPECT_GE(buffer->capacity(), 4096);
+	}
+
+	TEST(ResponseBufferPool, BufferReturnsWhenLastResponseIsDestroyed)
+	{
+		response_buffer_pool& pool{ response_buffer_pool::instance() };
+
+		std::shared_ptr<std::string> buffer{ pool.acquire() };
+		buffer->assign("{}");
+
+		int idleCount{ pool.idle_count() };
+
+		{
+			http_response response{ 200, std::move(buffer) };
+			http_response copy{ response };
+
+			EXPECT_EQ("{}", copy.body());
+			EXPECT_EQ(response.body().data(), copy.body().data());
+		}
+
+		EXPECT_EQ(idleCount + 1, pool.idle_count());
+	}
+
+	TEST(ResponseBufferPool, OversizedBuffersAreNotRetained)
+	{
+		response_buffer_pool& pool{ response_buffer_pool::instance() };
+		int idleCount{ pool.idle_count() };
+
+		{
+			std::shared_ptr<std::string> buffer{ pool.acquire() };
+			buffer->reserve(32 * 1024 * 1024);
+		}
+
+		EXPECT_GE(idleCount, pool.idle_count());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include "networking/http/retry_policy.h"
+#include "networking/http/http_error.h"
+#include "mbtest/mocks.h"
+
+namespace
+{
+	using namespace mb;
+
+	retry_settings fast_retry_settings()
+	{
+		retry_settings settings;
+		settings.maxAttempts = 3;
+		settings.initialBackoff = std::chrono::milliseconds{ 1 };
+		settings.maxBackoff = std::chrono::milliseconds{ 2 };
+
+		return settings;
+	}
+
+	http_response ok_response()
+	{
+		return http_response{ HttpResponseCodes::OK, "{}" };
+	}
+}
+
+namespace mb::test
+{
+	using testing::_;
+	using testing::Return;
+	using testing::Throw;
+
+	class RetryPolicyTest : public testing::Test
+	{
+	protected:
+		mock_http_service _httpService;
+		rate_limiter _rateLimiter{ rate_limit{ 100, 100 } };
+		http_request _request{ http_verb::GET, "https://api.exchange.com/ticker" };
+	};
+
+	TEST_F(RetryPolicyTest, NetworkErrorsAreRetried)
+	{
+		EXPECT_CALL(_httpService, send(_))
+			.WillOnce(Throw(http_error{ "connection reset" }))
+			.WillOnce(Return(ok_response()));
+
+		retry_policy policy{ fast_retry_settings() };
+
+		EXPECT_EQ(HttpResponseCodes::OK, policy.send(_httpService, _request, _rateLimiter).response_code());
+	}
+
+	TEST_F(RetryPolicyTest, TooManyRequestsIsRetried)
+	{
+		EXPECT_CALL(_httpService, send(_))
+			.WillOnce(Return(http_response{ 429, "", { http_header{ "Retry-After", "0" } } }))
+			.WillOnce(Return(ok_response()));
+
+		retry_policy policy{ fast_retry_settings() };
+
+		EXPECT_EQ(HttpResponseCodes::OK, policy.send(_httpService, _request, _rateLimiter).response_code());
+	}
+
+	TEST_F(RetryPolicyTest, RetryWaitsForRetryAfter)
+	{
+		EXPECT_CALL(_httpService, send(_))
+			.WillOnce(Return(http_response{ 429, "", { http_header{ "Retry-After", "1" } } }))
+			.WillOnce(Return(ok_response()));
+
+		retry_policy policy{ fast_retry_settings() };
+
+		auto start = std::chrono::steady_clock::now();
+		EXPECT_EQ(HttpResponseCodes::OK, policy.send(_httpService, _request, _rateLimiter).response_code());
+
+		EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::seconds{ 1 });
+	}
+
+	TEST_F(RetryPolicyTest, ExchangeRejectionIsNotRetried)
+	{
+		EXPECT_CALL(_httpService, send(_))
+			.Times(1)
+			.WillOnce(Return(http_response{ 400, R"({"msg":"Invalid symbol"})" }));
+
+		retry_policy policy{ fast_retry_settings() };
+
+		EXPECT_EQ(400, policy.send(_httpService, _request, _rateLimiter).response_code());
+	}
+
+	TEST_F(RetryPolicyTest, LastErrorIsThrownAfterMaxAttempts)
+	{
+		EXPECT_CALL(_httpService, send(_))
+			.Times(3)
+			.WillRepeatedly(Throw(http_error{ "timeout" }));
+
+		retry_policy policy{ fast_retry_settings() };
+
+		EXPECT_THROW(policy.send(_httpService, _request, _rateLimiter), http_error);
+	}
+
+	TEST_F(RetryPolicyTest, EndpointDeadlineStopsRetries)
+	{
+		EXPECT_CALL(_httpService, send(_))
+			.Times(1)
+			.WillOnce(Throw(http_error{ "timeout" }));
+
+		retry_policy policy{ fast_retry_settings() };
+		policy.set_deadline("/ticker", std::chrono::milliseconds{ 0 });
+
+		EXPECT_THROW(policy.send(_httpService, _request, _rateLimiter), http_error);
+		EXPECT_EQ(fast_retry_settings().deadline, policy.deadline("https://api.exchange.com/depth"));
+	}
+
+	TEST_F(RetryPolicyTest, BackoffGrowsUpToMaximum)
+	{
+		retry_settings settings;
+		settings.initialBackoff = std::chrono::milliseconds{ 100 };
+		settings.maxBackoff = std::chrono::milliseconds{ 1000 };
+
+		retry_policy policy{ settings };
+
+		for (int attempt = 0; attempt < 10; ++attempt)
+		{
+			std::chrono::milliseconds ceiling{ std::min<long long>(1000, 100 * (1LL << attempt)) };
+			EXPECT_LE(policy.backoff(attempt), ceiling);
+		}
+	}
+
+	TEST_F(RetryPolicyTest, SlowReadIsHedged)
+	{
+		std::promise<http_response> slowResponse;
+		std::promise<http_response> fastResponse;
+		fastResponse.set_value(http_response{ HttpResponseCodes::OK, "hedged" });
+
+		EXPECT_CALL(_httpService, send_async(_))
+			.WillOnce(Return(testing::ByMove(slowResponse.get_future())))
+			.WillOnce(Return(testing::ByMove(fastResponse.get_future())));
+
+		retry_settings settings{ fast_retry_settings() };
+		settings.hedgeMinSamples = 0;
+
+		retry_policy policy{ settings };
+		retry_policy::set_hedging_enabled(true);
+
+		http_response response{ policy.send(_httpService, _request, _rateLimiter) };
+		retry_policy::set_hedging_enabled(false);
+
+		EXPECT_EQ("hedged", response.body());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+
+#include "common/file/file.h"
+#include "common/json/json.h"
+#include "test_data/test_data_constants.h"
+
+namespace
+{
+	using namespace mb;
+	using namespace mb::test;
+
+	// permessage-deflate strips this tail from each compressed message and the receiver appends it again
+	constexpr unsigned char DEFLATE_TAIL[] = { 0x00, 0x00, 0xff, 0xff };
+	constexpr int BUFFER_SIZE = 16384;
+
+	std::vector<std::string> load_recorded_payloads()
+	{
+		std::vector<std::string> payloads;
+
+		for (std::string_view folder : { "binance/websockets", "kraken/websockets", "kraken_websocket_test" })
+		{
+			for (auto& entry : std::filesystem::directory_iterator{ std::filesystem::path{ TEST_DATA_FOLDER } / folder })
+			{
+				std::string payload{ read_file(entry.path()) };
+
+				if (!payload.empty())
+				{
+					payloads.emplace_back(std::move(payload));
+				}
+			}
+		}
+
+		return payloads;
+	}
+
+	// Both streams keep their sliding window between messages, as with context takeover on a live connection
+	class message_deflater
+	{
+	private:
+		z_stream _stream;
+
+	public:
+		message_deflater()
+			: _stream{}
+		{
+			deflateInit2(&_stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+		}
+
+		~message_deflater()
+		{
+			deflateEnd(&_stream);
+		}
+
+		std::string compress(const std::string& message)
+		{
+			std::string output;
+			unsigned char buffer[BUFFER_SIZE];
+
+			_stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(message.data()));
+			_stream.avail_in = static_cast<uInt>(message.size());
+
+			do
+			{
+				_stream.next_out = buffer;
+				_stream.avail_out = BUFFER_SIZE;
+				deflate(&_stream, Z_SYNC_FLUSH);
+				output.append(reinterpret_cast<char*>(buffer), BUFFER_SIZE - _stream.avail_out);
+			} while (_stream.avail_out == 0);
+
+			output.resize(output.size() - sizeof(DEFLATE_TAIL));
+			return output;
+		}
+	};
+
+	class message_inflater
+	{
+	private:
+		z_stream _stream;
+		std::string _output;
+
+		void inflate_bytes(const unsigned char* data, std::size_t size)
+		{
+			unsigned char buffer[BUFFER_SIZE];
+
+			_stream.next_in = const_cast<Bytef*>(data);
+			_stream.avail_in = static_cast<uInt>(size);
+
+			do
+			{
+				_stream.next_out = buffer;
+				_stream.avail_out = BUFFER_SIZE;
+				inflate(&_stream, Z_SYNC_FLUSH);
+				_output.append(reinterpret_cast<char*>(buffer), BUFFER_SIZE - _stream.avail_out);
+			} while (_stream.avail_out == 0);
+		}
+
+	public:
+		message_inflater()
+			: _stream{}, _output{}
+		{
+			inflateInit2(&_stream, -MAX_WBITS);
+		}
+
+		~message_inflater()
+		{
+			inflateEnd(&_stream);
+		}
+
+		const std::string& decompress(const std::string& message)
+		{
+			_output.clear();
+			inflate_bytes(reinterpret_cast<const unsigned char*>(message.data()), message.size());
+			inflate_bytes(DEFLATE_TAIL, sizeof(DEFLATE_TAIL));
+			return _output;
+		}
+	};
+}
+
+namespace mb::test
+{
+	TEST(WebsocketCompression, RecordedPayloadsRoundTrip)
+	{
+		std::vector<std::string> payloads{ load_recorded_payloads() };
+		ASSERT_FALSE(payloads.empty());
+
+		message_deflater deflater;
+		message_inflater inflater;
+
+		std::size_t rawBytes = 0;
+		std::size_t compressedBytes = 0;
+
+		for (auto& payload : payloads)
+		{
+			std::string compressed{ deflater.compress(payload) };
+
+			rawBytes += payload.size();
+			compressedBytes += compressed.size();
+
+			EXPECT_EQ(payload, inflater.decompress(compressed));
+		}
+
+		EXPECT_LT(compressedBytes, rawBytes);
+	}
+
+	// Run with --gtest_also_run_disabled_tests to compare bytes received and CPU per message
+	TEST(WebsocketCompression, DISABLED_BenchmarkRecordedPayloads)
+	{
+		constexpr int iterations = 2000;
+		std::vector<std::string> payloads{ load_recorded_payloads() };
+
+		message_deflater deflater;
+		std::vector<std::string> compressedPayloads;
+		std::size_t rawBytes = 0;
+		std::size_t compressedBytes = 0;
+
+		for (int i = 0; i < iterations; ++i)
+		{
+			for (auto& payload : payloads)
+			{
+				compressedPayloads.emplace_back(deflater.compress(payload));
+				rawBytes += payload.size();
+				compressedBytes += compressedPayloads.back().size();
+			}
+		}
+
+		std::size_t messageCount{ compressedPayloads.size() };
+
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i)
+		{
+			for (auto& payload : payloads)
+			{
+				parse_json(payload);
+			}
+		}
+		auto uncompressedTime = std::chrono::steady_clock::now() - start;
+
+		message_inflater inflater;
+		start = std::chrono::steady_clock::now();
+		for (auto& compressed : compressedPayloads)
+		{
+			parse_json(inflater.decompress(compressed));
+		}
+		auto compressedTime = std::chrono::steady_clock::now() - start;
+
+		auto nanosecondsPerMessage = [messageCount](auto duration)
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / static_cast<long long>(messageCount);
+		};
+
+		std::cout
+			<< "messages: " << messageCount << '\n'
+			<< "uncompressed: " << rawBytes << " bytes, " << nanosecondsPerMessage(uncompressedTime) << " ns/message\n"
+			<< "permessage-deflate: " << compressedBytes << " bytes, " << nanosecondsPerMessage(compressedTime) << " ns/message\n";
+	}
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include "runner/back_test_sweep.h"
+#include "mbtest/temp_directory.h"
+
+namespace
+{
+	using namespace mb;
+
+	const tradable_pair TEST_PAIR{ "BTC", "GBP" };
+
+	// Buys a fixed amount of BTC on its first iteration, so the final GBP balance depends on the run
+	class fixed_buy_strategy
+	{
+	private:
+		std::shared_ptr<exchange> _exchange;
+		double _volume;
+		int _iterations;
+
+	public:
+		explicit fixed_buy_strategy(double volume)
+			: _volume{ volume }, _iterations{ 0 }
+		{}
+
+		int iterations() const noexcept { return _iterations; }
+
+		void initialise(std::vector<std::shared_ptr<exchange>> exchanges)
+		{
+			_exchange = exchanges.front();
+		}
+
+		void run_iteration()
+		{
+			if (_iterations++ == 0 && _volume > 0)
+			{
+				_exchange->add_order(create_market_order(TEST_PAIR, trade_action::BUY, _volume));
+			}
+		}
+
+		report_result_list get_test_results() const
+		{
+			return { { "Volume", std::to_string(_volume) } };
+		}
+	};
+
+	class event_buy_strategy : public fixed_buy_strategy
+	{
+	public:
+		static constexpr time_advance TIME_ADVANCE = time_advance::EVENT;
+
+		using fixed_buy_strategy::fixed_buy_strategy;
+	};
+
+	std::shared_ptr<back_testing_data> create_test_data()
+	{
+		return std::make_shared<back_testing_data>(
+			std::vector<tradable_pair>{ TEST_PAIR },
+			std::unordered_map<tradable_pair, std::vector<ohlcv_data>>
+			{
+				{
+					TEST_PAIR,
+					{
+						ohlcv_data{ 100, 10, 10, 10, 10, 100 },
+						ohlcv_data{ 160, 10, 10, 10, 10, 100 },
+						ohlcv_data{ 220, 10, 10, 10, 10, 100 }
+					}
+				}
+			},
+			100,
+			220,
+			60,
+			3);
+	}
+}
+
+namespace mb::test
+{
+	class BackTestSweepTest : public temp_directory_test
+	{
+	};
+
+	TEST_F(BackTestSweepTest, RunsAreRankedByScore)
+	{
+		constexpr int runCount = 8;
+
+		back_test_sweep sweep{ create_test_data(), paper_trading_config{ 0, { { "GBP", 1000 } } }, _directory, 4 };
+		std::vector<int> iterations(runCount);
+
+		std::vector<sweep_result> results{ sweep.run(
+			runCount,
+			[](int run) { return std::make_unique<fixed_buy_strategy>(run); },
+			[&iterations](const fixed_buy_strategy& strategy, const paper_trade_api& tradeApi)
+			{
+				iterations[std::stoi(strategy.get_test_results().front().second)] = strategy.iterations();
+				return tradeApi.get_balances().at("GBP");
+			}) };
+
+		ASSERT_EQ(runCount, results.size());
+
+		for (int i = 0; i < runCount; ++i)
+		{
+			EXPECT_EQ(i, results[i].run());
+			EXPECT_DOUBLE_EQ(1000 - 10 * i, results[i].score());
+			EXPECT_EQ(3, iterations[i]);
+		}
+
+		EXPECT_TRUE(std::filesystem::exists(_directory / "sweep_summary.txt"));
+		EXPECT_TRUE(std::filesystem::exists(_directory / "run_0" / "report.txt"));
+	}
+
+	TEST_F(BackTestSweepTest, EventStrategyOnlyRunsWhenThereIsNewData)
+	{
+		auto backTestingData = std::make_shared<back_testing_data>(
+			std::vector<tradable_pair>{ TEST_PAIR },
+			std::unordered_map<tradable_pair, std::vector<ohlcv_data>>{ { TEST_PAIR, { ohlcv_data{ 100, 10, 10, 10, 10, 100 }, ohlcv_data{ 400, 10, 10, 10, 10, 100 } } } },
+			100,
+			400,
+			60,
+			6);
+
+		back_test_sweep sweep{ backTestingData, paper_trading_config{ 0, { { "GBP", 1000 } } }, _directory, 1 };
+		int stepIterations = 0;
+		int eventIterations = 0;
+
+		sweep.run(
+			1,
+			[](int) { return std::make_unique<fixed_buy_strategy>(0); },
+			[&stepIterations](const fixed_buy_strategy& strategy, const paper_trade_api&) { stepIterations = strategy.iterations(); return 0.0; });
+
+		sweep.run(
+			1,
+			[](int) { return std::make_unique<event_buy_strategy>(0); },
+			[&eventIterations](const event_buy_strategy& strategy, const paper_trade_api&) { eventIterations = strategy.iterations(); return 0.0; });
+
+		EXPECT_EQ(6, stepIterations);
+		EXPECT_EQ(2, eventIterations);
+	}
+
+	TEST_F(BackTestSweepTest, ErrorInRunIsRethrown)
+	{
+		back_test_sweep sweep{ create_test_data(), paper_trading_config{}, _directory, 2 };
+
+		EXPECT_THROW(sweep.run(
+			2,
+			[](int run) -> std::unique_ptr<fixed_buy_strategy> { throw std::runtime_error{ "Invalid parameters" }; },
+			[](const fixed_buy_strategy&, const paper_trade_api&) { return 0.0; }),
+			std::runtime_error);
+	}
+
+	TEST(SweepReport, TiesAreRankedInRunOrder)
+	{
+		test_report report{ "", "", "", "0", {}, {} };
+		std::vector<sweep_result> results
+		{
+			sweep_result{ 0, 1.0, report },
+			sweep_result{ 1, 2.0, report },
+			sweep_result{ 2, 1.0, report }
+		};
+
+		rank_sweep_results(results);
+
+		EXPECT_EQ(1, results[0].run());
+		EXPECT_EQ(0, results[1].run());
+		EXPECT_EQ(2, results[2].run());
+	}
+}
@@ -2,6 +2,8 @@
 
 #include "testing/back_testing/back_testing_data.h"
 #include "mbtest/assertion_helpers.h"
+#include "mbtest/mocks.h"
+#include "common/exceptions/mb_exception.h"
 
 namespace mb::test
 {
@@ -389,4 +391,141 @@ namespace mb::test
 
 		create_vector_equal_asserter<ohlcv_data>(assert_ohlcv_data_eq)(expectedData, actualData);
 	}
+
+	TEST(BackTestingData, CursorStartsAtBeginningAndMovesIndependently)
+	{
+		back_testing_data backTestingData
+		{
+			std::vector<tradable_pair>{ TEST_PAIR },
+			std::unordered_map<tradable_pair,std::vector<ohlcv_data>>{ { TEST_PAIR, TEST_DATA }},
+			100,
+			340,
+			60,
+			5
+		};
+
+		backTestingData.increment();
+		std::shared_ptr<back_testing_data> cursor{ backTestingData.create_cursor() };
+
+		assert_trade_update_eq(trade_update{ 100, 2, 3 }, cursor->get_trade(TEST_PAIR));
+
+		cursor->increment();
+		cursor->increment();
+
+		assert_trade_update_eq(trade_update{ 160, 7, 9 }, backTestingData.get_trade(TEST_PAIR));
+		assert_trade_update_eq(trade_update{ 220, 12, 14 }, cursor->get_trade(TEST_PAIR));
+	}
+
+	TEST(BackTestingData, DynamicallyLoadedDataCannotBeShared)
+	{
+		back_testing_data backTestingData
+		{
+			std::vector<tradable_pair>{ TEST_PAIR },
+			{},
+			100,
+			340,
+			60,
+			5,
+			std::make_unique<mock_back_testing_data_source>()
+		};
+
+		EXPECT_THROW(backTestingData.create_cursor(), mb_exception);
+	}
+
+	TEST(BackTestingData, IncrementSkipsGapsInData)
+	{
+		back_testing_data backTestingData
+		{
+			std::vector<tradable_pair>{ TEST_PAIR },
+			std::unordered_map<tradable_pair,std::vector<ohlcv_data>>{ { TEST_PAIR, TEST_DATA }},
+			100,
+			400,
+			150,
+			3
+		};
+
+		backTestingData.increment();
+		assert_trade_update_eq(trade_update{ 220, 12, 14 }, backTestingData.get_trade(TEST_PAIR));
+
+		backTestingData.increment();
+		assert_trade_update_eq(trade_update{ 340, 23, 24 }, backTestingData.get_trade(TEST_PAIR));
+	}
+
+	TEST(BackTestingData, DynamicallyLoadedPairStartsAtCurrentTime)
+	{
+		auto dataSource = std::make_unique<mock_back_testing_data_source>();
+		EXPECT_CALL(*dataSource, load_data(TEST_PAIR, 60))
+			.Times(1)
+			.WillOnce(testing::Return(TEST_DATA));
+
+		back_testing_data backTestingData
+		{
+			std::vector<tradable_pair>{ TEST_PAIR },
+			{},
+			100,
+			340,
+			60,
+			5,
+			std::move(dataSource)
+		};
+
+		backTestingData.increment();
+		backTestingData.increment();
+
+		assert_trade_update_eq(trade_update{ 220, 12, 14 }, backTestingData.get_trade(TEST_PAIR));
+
+		backTestingData.increment();
+
+		assert_trade_update_eq(trade_update{ 280, 17, 19 }, backTestingData.get_trade(TEST_PAIR));
+	}
+
+	TEST(BackTestingData, UnknownPairHasNoData)
+	{
+		back_testing_data backTestingData
+		{
+			std::vector<tradable_pair>{ TEST_PAIR },
+			std::unordered_map<tradable_pair,std::vector<ohlcv_data>>{ { TEST_PAIR, TEST_DATA }},
+			100,
+			340,
+			60,
+			5
+		};
+
+		tradable_pair unknownPair{ "ETH", "GBP" };
+
+		EXPECT_TRUE(backTestingData.get_ohlcv(unknownPair, 60, 1).empty());
+		assert_trade_update_eq(trade_update{ 0, 0, 0 }, backTestingData.get_trade(unknownPair));
+	}
+
+	TEST(BackTestingData, IncrementToNextEventSkipsIdleSteps)
+	{
+		tradable_pair otherPair{ "ETH", "GBP" };
+
+		back_testing_data backTestingData
+		{
+			std::vector<tradable_pair>{ TEST_PAIR, otherPair },
+			std::unordered_map<tradable_pair,std::vector<ohlcv_data>>
+			{
+				{ TEST_PAIR, { ohlcv_data{ 100, 2, 5, 1, 4, 3 }, ohlcv_data{ 400, 7, 10, 6, 8, 9 }, ohlcv_data{ 500, 12, 15, 11, 13, 14 } } },
+				{ otherPair, { ohlcv_data{ 250, 17, 20, 16, 18, 19 } } }
+			},
+			100,
+			400,
+			10,
+			31
+		};
+
+		ASSERT_TRUE(backTestingData.increment_to_next_event());
+		EXPECT_EQ(250, backTestingData.data_time());
+		assert_trade_update_eq(trade_update{ 250, 17, 19 }, backTestingData.get_trade(otherPair));
+		assert_trade_update_eq(trade_update{ 100, 2, 3 }, backTestingData.get_trade(TEST_PAIR));
+
+		ASSERT_TRUE(backTestingData.increment_to_next_event());
+		EXPECT_EQ(400, backTestingData.data_time());
+		assert_trade_update_eq(trade_update{ 400, 7, 9 }, backTestingData.get_trade(TEST_PAIR));
+
+		EXPECT_EQ(500, backTestingData.next_event_time());
+		EXPECT_FALSE(backTestingData.increment_to_next_event());
+		EXPECT_EQ(400, backTestingData.data_time());
+	}
 }
\ No newline at end of file
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+#include "testing/back_testing/data_loading/column_data_source.h"
+#include "testing/back_testing/data_loading/csv_data_source.h"
+#include "testing/back_testing/data_loading/ohlcv_column_file.h"
+#include "testing/back_testing/data_loading/data_factory.h"
+#include "common/exceptions/mb_exception.h"
+#include "common/file/file.h"
+#include "test_data/test_data_constants.h"
+#include "mbtest/assertion_helpers.h"
+#include "mbtest/temp_directory.h"
+
+namespace
+{
+	using namespace mb;
+	using namespace mb::test;
+
+	class ColumnDataSourceTest : public temp_directory_test
+	{
+	protected:
+		std::filesystem::path _csvDirectory;
+
+	public:
+		ColumnDataSourceTest()
+			: _csvDirectory{ std::filesystem::path{ TEST_DATA_FOLDER } / "csv_data_source_test" }
+		{}
+
+		void SetUp() override
+		{
+			temp_directory_test::SetUp();
+
+			for (std::string_view fileName : { "BTC_USD.csv", "ETH_GBP.csv" })
+			{
+				std::filesystem::copy_file(_csvDirectory / fileName, _directory / fileName);
+			}
+		}
+	};
+}
+
+namespace mb::test
+{
+	TEST_F(ColumnDataSourceTest, ConvertedDataMatchesCsvData)
+	{
+		EXPECT_EQ(2, convert_csv_directory(_directory));
+
+		column_data_source columnSource{ _directory };
+		csv_data_source csvSource{ _csvDirectory };
+		tradable_pair pair{ "BTC", "USD" };
+
+		for (int stepSize : { 0, 60, 120 })
+		{
+			create_vector_equal_asserter<ohlcv_data>(assert_ohlcv_data_eq)(csvSource.load_data(pair, stepSize), columnSource.load_data(pair, stepSize));
+		}
+	}
+
+	TEST_F(ColumnDataSourceTest, AvailablePairsComeFromColumnFiles)
+	{
+		convert_csv_directory(_directory);
+		std::filesystem::remove(_directory / "ETH_GBP.ohlcv");
+
+		column_data_source columnSource{ _directory };
+
+		EXPECT_EQ(std::vector<tradable_pair>{ tradable_pair("BTC", "USD") }, columnSource.get_available_pairs());
+	}
+
+	TEST_F(ColumnDataSourceTest, ColumnsAreSortedByTime)
+	{
+		write_ohlcv_column_file(_directory / "XRP_GBP.ohlcv", { ohlcv_data{ 200, 6, 7, 8, 9, 10 }, ohlcv_data{ 100, 1, 2, 3, 4, 5 } });
+
+		ohlcv_column_file columns{ _directory / "XRP_GBP.ohlcv" };
+
+		ASSERT_EQ(2, columns.size());
+		EXPECT_EQ(100, columns.time_stamps()[0]);
+		EXPECT_EQ(200, columns.time_stamps()[1]);
+		EXPECT_DOUBLE_EQ(9, columns.close()[1]);
+	}
+
+	TEST_F(ColumnDataSourceTest, UpToDateFilesAreNotConvertedAgain)
+	{
+		convert_csv_directory(_directory);
+
+		EXPECT_EQ(0, convert_csv_directory(_directory));
+	}
+
+	TEST_F(ColumnDataSourceTest, MappedFileCanBeConvertedAgain)
+	{
+		convert_csv_directory(_directory);
+
+		ohlcv_column_file mappedColumns{ _directory / "BTC_USD.ohlcv" };
+		std::filesystem::last_write_time(_directory / "BTC_USD.csv", std::filesystem::last_write_time(_directory / "BTC_USD.ohlcv") + std::chrono::seconds{ 1 });
+
+		EXPECT_EQ(1, convert_csv_directory(_directory));
+		EXPECT_EQ(5, mappedColumns.size());
+		EXPECT_EQ(100, mappedColumns.time_stamps()[0]);
+		EXPECT_EQ(5, ohlcv_column_file{ _directory / "BTC_USD.ohlcv" }.size());
+	}
+
+	TEST_F(ColumnDataSourceTest, InvalidFileThrows)
+	{
+		write_to_file(_directory / "XRP_GBP.ohlcv", "100,1,2,3,4,5\n160,6,7,8,9,10\n");
+
+		EXPECT_THROW(ohlcv_column_file{ _directory / "XRP_GBP.ohlcv" }, mb_exception);
+	}
+
+	TEST_F(ColumnDataSourceTest, OverflowingCountThrows)
+	{
+		// A count whose row bytes wrap round to exactly the one row that follows the header
+		column_file_header header{};
+		std::memcpy(header.magic, OHLCV_COLUMN_FORMAT.magic, sizeof(header.magic));
+		header.version = OHLCV_COLUMN_FORMAT.version;
+		header.count = (std::uint64_t{ 1 } << 60) + 1;
+
+		{
+			std::ofstream stream{ _directory / "XRP_GBP.ohlcv", std::ios::binary };
+			stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+			std::vector<double> row(6, 1.0);
+			stream.write(reinterpret_cast<const char*>(row.data()), row.size() * sizeof(double));
+		}
+
+		EXPECT_THROW(ohlcv_column_file{ _directory / "XRP_GBP.ohlcv" }, mb_exception);
+	}
+
+	TEST_F(ColumnDataSourceTest, DataFactoryPrefersColumnFiles)
+	{
+		convert_csv_directory(_directory);
+
+		std::unique_ptr<back_testing_data_source> dataSource{ create_data_source(_directory.string()) };
+
+		EXPECT_NE(nullptr, dynamic_cast<column_data_source*>(dataSource.get()));
+	}
+
+	TEST_F(ColumnDataSourceTest, DataFactoryConvertsCsvFilesMissingColumnFiles)
+	{
+		convert_csv_directory(_directory);
+		std::filesystem::remove(_directory / "ETH_GBP.ohlcv");
+
+		std::unique_ptr<back_testing_data_source> dataSource{ create_data_source(_directory.string()) };
+
+		EXPECT_EQ(2, dataSource->get_available_pairs().size());
+		EXPECT_TRUE(std::filesystem::exists(_directory / "ETH_GBP.ohlcv"));
+	}
+
+	TEST_F(ColumnDataSourceTest, DISABLED_BenchmarkLoadData)
+	{
+		constexpr int rowCount = 1000000;
+
+		{
+			std::ofstream stream{ _directory / "BTC_GBP.csv" };
+			for (int i = 0; i < rowCount; ++i)
+			{
+				stream << i * 60 << ",1.5,2.5,0.5,2,1000.25\n";
+			}
+		}
+
+		tradable_pair pair{ "BTC", "GBP" };
+
+		auto start = std::chrono::steady_clock::now();
+		csv_data_source{ _directory }.load_data(pair, 0);
+		auto csvTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+		convert_csv_directory(_directory);
+
+		start = std::chrono::steady_clock::now();
+		column_data_source{ _directory }.load_data(pair, 0);
+		auto columnTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+		std::cout << "load_data for " << rowCount << " rows\n"
+			<< "  csv:     " << csvTime.count() << "ms\n"
+			<< "  columns: " << columnTime.count() << "ms\n";
+	}
+
+	TEST_F(ColumnDataSourceTest, DataFactoryConvertsRecordedTradesAndOrderBooks)
+	{
+		write_to_file(_directory / "BTC_USD.trades.csv", "100,2.5,0.1\n160,3.5,0.2\n");
+		write_to_file(_directory / "BTC_USD.book.csv", "100,ASK,10.5,1,1\n100,BID,9.5,2\n");
+
+		std::unique_ptr<back_testing_data_source> dataSource{ create_data_source(_directory.string()) };
+		tradable_pair pair{ "BTC", "USD" };
+
+		EXPECT_EQ(2, dataSource->get_available_pairs().size());
+		ASSERT_NE(nullptr, dataSource->load_trades(pair));
+		EXPECT_EQ(2, dataSource->load_trades(pair)->size());
+		ASSERT_NE(nullptr, dataSource->load_order_book_deltas(pair));
+		EXPECT_EQ(2, dataSource->load_order_book_deltas(pair)->size());
+	}
+}
\ No newline at end of file
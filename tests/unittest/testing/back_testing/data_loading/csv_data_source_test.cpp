@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
 
 #include "testing/back_testing/data_loading/csv_data_source.h"
+#include "common/file/file.h"
 #include "test_data/test_data_constants.h"
 #include "mbtest/assertion_helpers.h"
+#include "mbtest/temp_directory.h"
 
 namespace
 {
@@ -112,4 +114,52 @@ namespace mb::test
 
 		EXPECT_TRUE(dataSource.load_data(pair, 0).empty());
 	}
+
+	TEST(CSVDataSource, LoadDataRangeLoadsOnlyRange)
+	{
+		tradable_pair pair{ "BTC", "USD" };
+
+		std::vector<ohlcv_data> expectedData
+		{
+			ohlcv_data{ 160, 6, 7, 8, 9, 10 },
+			ohlcv_data{ 220, 11, 12, 13, 14, 15 },
+			ohlcv_data{ 280, 16, 17, 18, 19, 20 }
+		};
+
+		auto dataSource = create_data_source();
+
+		std::vector<ohlcv_data> actualData{ dataSource.load_data_range(pair, 0, 150, 340) };
+
+		create_vector_equal_asserter<ohlcv_data>(assert_ohlcv_data_eq)(expectedData, actualData);
+		EXPECT_EQ(5, dataSource.load_data_range(pair, 0, 0, 1000).size());
+		EXPECT_TRUE(dataSource.load_data_range(pair, 0, 400, 1000).empty());
+	}
+
+	TEST(CSVDataSource, LoadDataRangeReadsWholeFileWhenNotInTimeOrder)
+	{
+		tradable_pair pair{ "BTC", "USD" };
+		std::filesystem::path directory{ test_temp_directory() };
+		std::filesystem::create_directories(directory);
+		write_to_file(directory / "BTC_USD.csv", "220,11,12,13,14,15\n100,1,2,3,4,5\n340,21,22,23,24,25\n160,6,7,8,9,10\n280,16,17,18,19,20\n");
+
+		std::vector<ohlcv_data> expectedData
+		{
+			ohlcv_data{ 160, 6, 7, 8, 9, 10 },
+			ohlcv_data{ 220, 11, 12, 13, 14, 15 },
+			ohlcv_data{ 280, 16, 17, 18, 19, 20 }
+		};
+
+		csv_data_source dataSource{ directory };
+
+		std::vector<ohlcv_data> firstRead{ dataSource.load_data_range(pair, 0, 150, 340) };
+		std::vector<ohlcv_data> secondRead{ dataSource.load_data_range(pair, 0, 150, 340) };
+		std::vector<ohlcv_data> laterWindow{ dataSource.load_data_range(pair, 0, 300, 1000) };
+
+		std::filesystem::remove_all(directory);
+
+		create_vector_equal_asserter<ohlcv_data>(assert_ohlcv_data_eq)(expectedData, firstRead);
+		create_vector_equal_asserter<ohlcv_data>(assert_ohlcv_data_eq)(expectedData, secondRead);
+		ASSERT_EQ(1, laterWindow.size());
+		EXPECT_EQ(340, laterWindow.front().time_stamp());
+	}
 }
\ No newline at end of file
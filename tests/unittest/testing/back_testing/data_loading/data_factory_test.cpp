@@ -4,6 +4,7 @@
 #include "test_data/test_data_constants.h"
 #include "mbtest/mocks.h"
 #include "mbtest/assertion_helpers.h"
+#include "common/exceptions/mb_exception.h"
 
 namespace mb::test
 {
@@ -25,7 +26,10 @@ namespace mb::test
 			endTime,
 			stepSize,
 			TestDataDirectory,
-			true
+			true,
+			0,
+			0,
+			0
 		};
 
 		std::unique_ptr<back_testing_data_source> mockDataSource{ std::make_unique<mock_back_testing_data_source>() };
@@ -44,7 +48,10 @@ namespace mb::test
 			50,
 			10,
 			TestDataDirectory,
-			true
+			true,
+			0,
+			0,
+			0
 		};
 
 		std::vector<tradable_pair> expectedPairs
@@ -71,7 +78,10 @@ namespace mb::test
 			340,
 			60,
 			TestDataDirectory,
-			false
+			false,
+			0,
+			0,
+			0
 		};
 
 		std::vector<tradable_pair> expectedPairs
@@ -95,7 +105,10 @@ namespace mb::test
 			0,
 			60,
 			TestDataDirectory,
-			false
+			false,
+			0,
+			0,
+			0
 		};
 
 		tradable_pair pair{ "BTC", "USD" };
@@ -137,7 +150,10 @@ namespace mb::test
 			endTime,
 			60,
 			TestDataDirectory,
-			false
+			false,
+			0,
+			0,
+			0
 		};
 
 		tradable_pair pair{ "BTC", "USD" };
@@ -167,4 +183,67 @@ namespace mb::test
 		EXPECT_EQ(endTime, data->end_time());
 		EXPECT_EQ(6, data->time_steps());
 	}
+
+	TEST(DataFactory, ParallelLoadMergesAllPairs)
+	{
+		back_testing_config config
+		{
+			0,
+			0,
+			60,
+			TestDataDirectory,
+			false,
+			4,
+			0,
+			0
+		};
+
+		std::vector<tradable_pair> pairs;
+		for (int i = 0; i < 16; ++i)
+		{
+			pairs.emplace_back("ASSET" + std::to_string(i), "GBP");
+		}
+
+		std::unique_ptr<mock_back_testing_data_source> mockDataSource{ std::make_unique<mock_back_testing_data_source>() };
+
+		EXPECT_CALL(*mockDataSource, get_available_pairs()).WillOnce(Return(pairs));
+		EXPECT_CALL(*mockDataSource, load_data(_, 60))
+			.Times(pairs.size())
+			.WillRepeatedly(testing::Invoke([](const tradable_pair& pair, int)
+			{
+				std::time_t offset{ std::stoi(pair.asset().substr(5)) * 60 };
+				return std::vector<ohlcv_data>{ ohlcv_data{ 1000 + offset, 1, 1, 1, 1, 1 }, ohlcv_data{ 2000 + offset, 1, 1, 1, 1, 1 } };
+			}));
+
+		std::shared_ptr<back_testing_data> data{ load_back_testing_data(std::move(mockDataSource), config) };
+
+		EXPECT_EQ(1000, data->start_time());
+		EXPECT_EQ(2000 + 15 * 60, data->end_time());
+		EXPECT_EQ(pairs, data->tradable_pairs());
+	}
+
+	TEST(DataFactory, ParallelLoadRethrowsDataSourceErrors)
+	{
+		back_testing_config config
+		{
+			0,
+			0,
+			60,
+			TestDataDirectory,
+			false,
+			4,
+			0,
+			0
+		};
+
+		std::vector<tradable_pair> pairs{ tradable_pair{ "BTC", "GBP" }, tradable_pair{ "ETH", "GBP" } };
+
+		std::unique_ptr<mock_back_testing_data_source> mockDataSource{ std::make_unique<mock_back_testing_data_source>() };
+
+		EXPECT_CALL(*mockDataSource, get_available_pairs()).WillOnce(Return(pairs));
+		EXPECT_CALL(*mockDataSource, load_data(_, _))
+			.WillRepeatedly(testing::Throw(mb_exception{ "corrupt file" }));
+
+		EXPECT_THROW(load_back_testing_data(std::move(mockDataSource), config), mb_exception);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <mutex>
+
+#include "testing/back_testing/data_loading/ohlcv_window_loader.h"
+#include "testing/back_testing/data_loading/ohlcv_column_file.h"
+#include "testing/back_testing/data_loading/column_data_source.h"
+#include "testing/back_testing/back_testing_data.h"
+#include "mbtest/assertion_helpers.h"
+#include "mbtest/temp_directory.h"
+
+namespace
+{
+	using namespace mb;
+
+	const tradable_pair TEST_PAIR{ "BTC", "GBP" };
+	const tradable_pair OTHER_PAIR{ "ETH", "GBP" };
+
+	// A candle every 100 seconds whose prices are its time stamp
+	std::vector<ohlcv_data> create_candles(std::time_t endTime)
+	{
+		std::vector<ohlcv_data> data;
+
+		for (std::time_t time = 0; time < endTime; time += 100)
+		{
+			double price = static_cast<double>(time);
+			data.emplace_back(time, price, price, price, price, 1);
+		}
+
+		return data;
+	}
+
+	class recording_data_source : public back_testing_data_source
+	{
+	private:
+		mutable std::mutex _mutex;
+		std::vector<std::pair<tradable_pair, std::time_t>> _rangeLoads;
+
+	public:
+		std::vector<tradable_pair> get_available_pairs() override { return { TEST_PAIR, OTHER_PAIR }; }
+		std::vector<ohlcv_data> load_data(const tradable_pair& pair, int stepSize) override { return create_candles(2000); }
+
+		std::vector<ohlcv_data> load_data_range(const tradable_pair& pair, int stepSize, std::time_t startTime, std::time_t endTime) override
+		{
+			{
+				std::lock_guard lock{ _mutex };
+				_rangeLoads.emplace_back(pair, startTime);
+			}
+
+			return back_testing_data_source::load_data_range(pair, stepSize, startTime, endTime);
+		}
+
+		int count_range_loads(const tradable_pair& pair, std::time_t startTime) const
+		{
+			std::lock_guard lock{ _mutex };
+			return std::count(_rangeLoads.begin(), _rangeLoads.end(), std::make_pair(pair, startTime));
+		}
+	};
+
+	std::vector<std::time_t> get_times(const std::vector<ohlcv_data>& data)
+	{
+		std::vector<std::time_t> times;
+
+		for (const ohlcv_data& item : data)
+		{
+			times.push_back(item.time_stamp());
+		}
+
+		return times;
+	}
+}
+
+namespace mb::test
+{
+	TEST(OhlcvWindowLoader, WindowHoldsChunkAndChunkBefore)
+	{
+		recording_data_source dataSource;
+		ohlcv_window_loader loader{ dataSource, 100, 300, 1000, 200 };
+
+		EXPECT_EQ((std::vector<std::time_t>{ 100, 200, 300, 400 }), get_times(loader.load_window(TEST_PAIR, 450)));
+		EXPECT_EQ(500, loader.window_end(450));
+
+		EXPECT_EQ((std::vector<std::time_t>{ 300, 400, 500, 600 }), get_times(loader.load_window(TEST_PAIR, 500)));
+		EXPECT_EQ(1, dataSource.count_range_loads(TEST_PAIR, 300));
+
+		EXPECT_EQ((std::vector<std::time_t>{ 0, 100, 200 }), get_times(loader.load_window(TEST_PAIR, 250)));
+		EXPECT_EQ(300, loader.window_end(250));
+	}
+
+	TEST(OhlcvWindowLoader, ColumnSourceLoadsOnlyRange)
+	{
+		std::filesystem::path directory{ test_temp_directory() };
+		std::filesystem::create_directories(directory);
+		write_ohlcv_column_file(directory / "BTC_GBP.ohlcv", create_candles(1000));
+
+		column_data_source dataSource{ directory };
+		std::vector<ohlcv_data> data{ dataSource.load_data_range(TEST_PAIR, 200, 250, 750) };
+
+		std::filesystem::remove_all(directory);
+
+		EXPECT_EQ((std::vector<std::time_t>{ 300, 500, 700 }), get_times(data));
+	}
+
+	TEST(OhlcvWindowLoader, BackTestingDataMovesWindowWithDataTime)
+	{
+		back_testing_data backTestingData
+		{
+			{ TEST_PAIR },
+			{},
+			300,
+			1500,
+			100,
+			13,
+			std::make_unique<recording_data_source>(),
+			200
+		};
+
+		for (int i = 0; i < backTestingData.time_steps(); ++i)
+		{
+			std::time_t time{ backTestingData.data_time() };
+
+			EXPECT_DOUBLE_EQ(static_cast<double>(time), backTestingData.get_trade(TEST_PAIR).price());
+			EXPECT_EQ((std::vector<std::time_t>{ time - 100, time - 200 }), get_times(backTestingData.get_ohlcv(TEST_PAIR, 100, 2)));
+
+			backTestingData.increment();
+		}
+	}
+
+	TEST(OhlcvWindowLoader, LongerLookBackWidensWindow)
+	{
+		back_testing_data backTestingData
+		{
+			{ TEST_PAIR },
+			{},
+			300,
+			1500,
+			100,
+			13,
+			std::make_unique<recording_data_source>(),
+			200
+		};
+
+		for (int i = 0; i < 4; ++i)
+		{
+			backTestingData.increment();
+		}
+
+		EXPECT_EQ((std::vector<std::time_t>{ 600, 500, 400, 300 }), get_times(backTestingData.get_ohlcv(TEST_PAIR, 100, 4)));
+
+		backTestingData.increment();
+		backTestingData.increment();
+
+		EXPECT_EQ((std::vector<std::time_t>{ 800, 700, 600, 500 }), get_times(backTestingData.get_ohlcv(TEST_PAIR, 100, 4)));
+	}
+
+	TEST(OhlcvWindowLoader, LeastRecentlyUsedWindowIsEvictedOverMemoryBudget)
+	{
+		auto dataSource = std::make_unique<recording_data_source>();
+		recording_data_source& recordedLoads{ *dataSource };
+
+		back_testing_data backTestingData
+		{
+			{ TEST_PAIR, OTHER_PAIR },
+			{},
+			300,
+			1500,
+			100,
+			13,
+			std::move(dataSource),
+			200,
+			1
+		};
+
+		EXPECT_DOUBLE_EQ(300, backTestingData.get_trade(TEST_PAIR).price());
+		EXPECT_DOUBLE_EQ(300, backTestingData.get_trade(OTHER_PAIR).price());
+		EXPECT_DOUBLE_EQ(300, backTestingData.get_trade(TEST_PAIR).price());
+
+		EXPECT_EQ(2, recordedLoads.count_range_loads(TEST_PAIR, 100));
+		EXPECT_EQ(1, recordedLoads.count_range_loads(OTHER_PAIR, 100));
+	}
+}
\ No newline at end of file
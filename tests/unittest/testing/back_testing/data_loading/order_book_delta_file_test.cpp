@@ -0,0 +1,257 @@
+#include <gtest/gtest.h>
+#include <chrono>
+
+#include "testing/back_testing/data_loading/order_book_delta_file.h"
+#include "testing/back_testing/backtest_websocket_stream.h"
+#include "testing/paper_trading/paper_trade_api.h"
+#include "runner/back_test_runner.h"
+#include "common/exceptions/mb_exception.h"
+#include "common/file/file.h"
+#include "mbtest/temp_directory.h"
+
+namespace
+{
+	using namespace mb;
+	using namespace mb::test;
+
+	const tradable_pair TEST_PAIR{ "BTC", "GBP" };
+
+	order_book_delta ask(std::time_t timeStamp, double price, double volume, bool startsSnapshot = false)
+	{
+		return order_book_delta{ timeStamp, order_book_entry{ price, volume, order_book_side::ASK }, startsSnapshot };
+	}
+
+	order_book_delta bid(std::time_t timeStamp, double price, double volume, bool startsSnapshot = false)
+	{
+		return order_book_delta{ timeStamp, order_book_entry{ price, volume, order_book_side::BID }, startsSnapshot };
+	}
+
+	std::vector<double> prices(const std::vector<order_book_entry>& entries)
+	{
+		std::vector<double> result;
+
+		for (const order_book_entry& entry : entries)
+		{
+			result.push_back(entry.price());
+		}
+
+		return result;
+	}
+
+	class OrderBookDeltaFileTest : public temp_directory_test
+	{
+	protected:
+		std::filesystem::path _path{ _directory / "BTC_GBP.book" };
+
+		// A stale snapshot, the snapshot current at the start, then changes during the second step
+		std::shared_ptr<back_testing_data> create_back_testing_data()
+		{
+			write_order_book_delta_file(_path,
+				{
+					ask(20, 5, 1, true),
+					ask(50, 10, 1, true),
+					ask(50, 11, 2),
+					bid(50, 9, 1),
+					ask(130, 10, 0),
+					bid(140, 9.5, 2)
+				});
+
+			auto backTestingData = std::make_shared<back_testing_data>(
+				std::vector<tradable_pair>{ TEST_PAIR },
+				std::unordered_map<tradable_pair, std::vector<ohlcv_data>>{ { TEST_PAIR, { ohlcv_data{ 100, 1, 1, 1, 1, 1 } } } },
+				100,
+				220,
+				60,
+				3);
+
+			backTestingData->set_order_book_deltas(TEST_PAIR, load_order_book_delta_file(_directory, TEST_PAIR));
+			return backTestingData;
+		}
+	};
+}
+
+namespace mb::test
+{
+	TEST_F(OrderBookDeltaFileTest, DeltasAreSortedByTimeKeepingRecordedOrder)
+	{
+		write_order_book_delta_file(_path, { bid(200, 9, 0), ask(100, 10, 1, true), bid(100, 8, 2) });
+
+		order_book_delta_file deltas{ _path };
+
+		ASSERT_EQ(3, deltas.size());
+		EXPECT_EQ(100, deltas[0].time_stamp());
+		EXPECT_TRUE(deltas[0].starts_snapshot());
+		EXPECT_EQ(order_book_side::ASK, deltas[0].entry().side());
+		EXPECT_FALSE(deltas[1].starts_snapshot());
+		EXPECT_EQ(order_book_side::BID, deltas[1].entry().side());
+		EXPECT_DOUBLE_EQ(2, deltas[1].entry().volume());
+		EXPECT_DOUBLE_EQ(9, deltas[2].entry().price());
+	}
+
+	TEST_F(OrderBookDeltaFileTest, DeltasAreReadFromCsv)
+	{
+		std::filesystem::path csvPath{ _directory / "book.csv" };
+		write_to_file(csvPath, "100,ASK,10.5,1,1\r\n100,BID,9.5,2\r\n");
+
+		std::vector<order_book_delta> deltas{ read_order_book_delta_csv_file(csvPath) };
+
+		ASSERT_EQ(2, deltas.size());
+		EXPECT_TRUE(deltas[0].starts_snapshot());
+		EXPECT_EQ(order_book_side::BID, deltas[1].entry().side());
+		EXPECT_DOUBLE_EQ(9.5, deltas[1].entry().price());
+
+		write_to_file(csvPath, "100,BUY,10.5,1\n");
+		EXPECT_THROW(read_order_book_delta_csv_file(csvPath), mb_exception);
+	}
+
+	TEST_F(OrderBookDeltaFileTest, InvalidFileThrows)
+	{
+		write_to_file(_path, "100,ASK,10,1\n");
+
+		EXPECT_THROW(order_book_delta_file{ _path }, mb_exception);
+		EXPECT_EQ(nullptr, load_order_book_delta_file(_directory, tradable_pair{ "ETH", "GBP" }));
+	}
+
+	TEST_F(OrderBookDeltaFileTest, BookIsRebuiltFromLastSnapshotAndUpdatedEachStep)
+	{
+		std::shared_ptr<back_testing_data> backTestingData{ create_back_testing_data() };
+
+		ASSERT_TRUE(backTestingData->has_order_book(TEST_PAIR));
+
+		order_book_state orderBook{ backTestingData->get_order_book(TEST_PAIR) };
+		EXPECT_EQ((std::vector<double>{ 10, 11 }), prices(orderBook.asks()));
+		EXPECT_EQ((std::vector<double>{ 9 }), prices(orderBook.bids()));
+		EXPECT_EQ(3, backTestingData->get_new_order_book_deltas(TEST_PAIR).size());
+
+		backTestingData->increment();
+
+		orderBook = backTestingData->get_order_book(TEST_PAIR);
+		EXPECT_EQ((std::vector<double>{ 11 }), prices(orderBook.asks()));
+		EXPECT_EQ((std::vector<double>{ 9.5, 9 }), prices(orderBook.bids()));
+		EXPECT_EQ(2, backTestingData->get_new_order_book_deltas(TEST_PAIR).size());
+		EXPECT_EQ(1, backTestingData->get_order_book(TEST_PAIR, 1).bids().size());
+
+		std::shared_ptr<back_testing_data> cursor{ backTestingData->create_cursor() };
+		EXPECT_EQ((std::vector<double>{ 9 }), prices(cursor->get_order_book(TEST_PAIR).bids()));
+		EXPECT_EQ((std::vector<double>{ 9.5, 9 }), prices(backTestingData->get_order_book(TEST_PAIR).bids()));
+
+		backTestingData->increment();
+
+		EXPECT_TRUE(backTestingData->get_new_order_book_deltas(TEST_PAIR).empty());
+	}
+
+	TEST_F(OrderBookDeltaFileTest, StreamReplaysEveryDelta)
+	{
+		std::shared_ptr<back_testing_data> backTestingData{ create_back_testing_data() };
+		backTestingData->increment();
+
+		backtest_websocket_stream stream{ backTestingData };
+		stream.subscribe(websocket_subscription::create_order_book_sub({ TEST_PAIR }));
+
+		std::vector<order_book_entry> entries;
+		stream.add_order_book_update_handler([&entries](order_book_update_message message) { entries.push_back(message.entry()); });
+
+		stream.notify();
+
+		ASSERT_EQ(2, entries.size());
+		EXPECT_DOUBLE_EQ(0, entries[0].volume());
+		EXPECT_DOUBLE_EQ(9.5, entries[1].price());
+	}
+
+	TEST_F(OrderBookDeltaFileTest, StreamMarksDeltasThatStartSnapshots)
+	{
+		std::shared_ptr<back_testing_data> backTestingData{ create_back_testing_data() };
+
+		backtest_websocket_stream stream{ backTestingData };
+		stream.subscribe(websocket_subscription::create_order_book_sub({ TEST_PAIR }));
+
+		std::vector<bool> startsSnapshot;
+		stream.add_order_book_update_handler([&startsSnapshot](order_book_update_message message) { startsSnapshot.push_back(message.starts_snapshot()); });
+
+		stream.notify();
+
+		EXPECT_EQ((std::vector<bool>{ true, false, false }), startsSnapshot);
+	}
+
+	TEST_F(OrderBookDeltaFileTest, MarketOrderWalksRecordedBook)
+	{
+		std::shared_ptr<back_testing_data> backTestingData{ create_back_testing_data() };
+
+		auto stream = std::make_shared<backtest_websocket_stream>(backTestingData);
+		paper_trade_api paperTradeApi
+		{
+			paper_trading_config{ 0, { { "GBP", 100 } } },
+			stream,
+			"BACK_TEST",
+			[backTestingData]() { return backTestingData->data_time(); },
+			internal::create_order_book_function(backTestingData)
+		};
+
+		paperTradeApi.add_order(create_market_order(TEST_PAIR, trade_action::BUY, 2));
+
+		ASSERT_EQ(1, paperTradeApi.get_closed_orders().size());
+		EXPECT_DOUBLE_EQ(10.5, paperTradeApi.get_closed_orders().front().price());
+		EXPECT_DOUBLE_EQ(79, paperTradeApi.get_balances().at("GBP"));
+
+		// The candle's close of 1 is below the limit, so only the recorded bids can fill it, at the bid crossed
+		std::string orderId{ paperTradeApi.add_order(create_limit_order(TEST_PAIR, trade_action::SELL, 8, 1)) };
+		EXPECT_EQ(order_status::CLOSED, paperTradeApi.get_order_status(orderId));
+		EXPECT_DOUBLE_EQ(9, paperTradeApi.get_closed_orders().back().price());
+
+		// Only one unit is offered at or below the limit, so the rest is assumed to fill at the limit
+		paperTradeApi.add_order(create_limit_order(TEST_PAIR, trade_action::BUY, 10.5, 2));
+		EXPECT_DOUBLE_EQ(10.25, paperTradeApi.get_closed_orders().back().price());
+	}
+
+	TEST_F(OrderBookDeltaFileTest, DISABLED_BenchmarkReplayOrderBook)
+	{
+		constexpr int deltaCount = 10000000;
+		constexpr int stepSize = 60;
+		constexpr int levelCount = 50;
+
+		std::vector<order_book_delta> recordedDeltas;
+		recordedDeltas.reserve(deltaCount);
+
+		for (int i = 0; i < deltaCount; ++i)
+		{
+			double level = i % levelCount;
+			double volume = i % 3;
+
+			recordedDeltas.push_back(i % 2 == 0
+				? ask(i / 100, 100.0 + level, volume, i % 100000 == 0)
+				: bid(i / 100, 99.0 - level, volume));
+		}
+
+		write_order_book_delta_file(_path, std::move(recordedDeltas));
+
+		int steps{ deltaCount / 100 / stepSize + 1 };
+		auto backTestingData = std::make_shared<back_testing_data>(
+			std::vector<tradable_pair>{ TEST_PAIR },
+			std::unordered_map<tradable_pair, std::vector<ohlcv_data>>{},
+			0,
+			(steps - 1) * stepSize,
+			stepSize,
+			steps);
+
+		backTestingData->set_order_book_deltas(TEST_PAIR, load_order_book_delta_file(_directory, TEST_PAIR));
+
+		backtest_websocket_stream stream{ backTestingData };
+		stream.subscribe(websocket_subscription::create_order_book_sub({ TEST_PAIR }));
+
+		size_t updates = 0;
+		stream.add_order_book_update_handler([&updates](order_book_update_message) { ++updates; });
+
+		auto start = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < steps; ++i)
+		{
+			stream.notify();
+			backTestingData->increment();
+		}
+
+		std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+		std::cout << "Replayed " << updates << " order book changes in " << elapsed.count() << "s ("
+			<< static_cast<long long>(updates / elapsed.count()) << " per second)\n";
+	}
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <chrono>
+
+#include "testing/back_testing/data_loading/trade_column_file.h"
+#include "testing/back_testing/backtest_websocket_stream.h"
+#include "testing/paper_trading/paper_trade_api.h"
+#include "common/exceptions/mb_exception.h"
+#include "common/file/file.h"
+#include "mbtest/assertion_helpers.h"
+#include "mbtest/temp_directory.h"
+
+namespace
+{
+	using namespace mb;
+	using namespace mb::test;
+
+	const tradable_pair TEST_PAIR{ "BTC", "GBP" };
+
+	class TradeColumnFileTest : public temp_directory_test
+	{
+	protected:
+		std::filesystem::path _path{ _directory / "BTC_GBP.trades" };
+
+		std::shared_ptr<back_testing_data> create_back_testing_data(std::vector<trade_update> trades)
+		{
+			write_trade_column_file(_path, std::move(trades));
+
+			auto backTestingData = std::make_shared<back_testing_data>(
+				std::vector<tradable_pair>{ TEST_PAIR },
+				std::unordered_map<tradable_pair, std::vector<ohlcv_data>>{ { TEST_PAIR, { ohlcv_data{ 100, 1, 1, 1, 1, 1 } } } },
+				100,
+				220,
+				60,
+				3);
+
+			backTestingData->set_trades(TEST_PAIR, load_trade_column_file(_directory, TEST_PAIR));
+			return backTestingData;
+		}
+	};
+}
+
+namespace mb::test
+{
+	TEST_F(TradeColumnFileTest, TradesAreSortedByTimeKeepingRecordedOrder)
+	{
+		write_trade_column_file(_path, { trade_update{ 200, 3, 1 }, trade_update{ 100, 1, 1 }, trade_update{ 100, 2, 1 } });
+
+		trade_column_file trades{ _path };
+
+		ASSERT_EQ(3, trades.size());
+		assert_trade_update_eq(trade_update{ 100, 1, 1 }, trades[0]);
+		assert_trade_update_eq(trade_update{ 100, 2, 1 }, trades[1]);
+		assert_trade_update_eq(trade_update{ 200, 3, 1 }, trades[2]);
+	}
+
+	TEST_F(TradeColumnFileTest, TradesAreReadFromCsv)
+	{
+		std::filesystem::path csvPath{ _directory / "trades.csv" };
+		write_to_file(csvPath, "100,2.5,0.1\r\n160,3.5,0.2\r\n");
+
+		std::vector<trade_update> trades{ read_trade_csv_file(csvPath) };
+
+		ASSERT_EQ(2, trades.size());
+		assert_trade_update_eq(trade_update{ 160, 3.5, 0.2 }, trades[1]);
+	}
+
+	TEST_F(TradeColumnFileTest, InvalidFileThrows)
+	{
+		write_to_file(_path, "100,2.5,0.1\n");
+
+		EXPECT_THROW(trade_column_file{ _path }, mb_exception);
+		EXPECT_EQ(nullptr, load_trade_column_file(_directory, tradable_pair{ "ETH", "GBP" }));
+	}
+
+	TEST_F(TradeColumnFileTest, EachStepHasTradesSinceThePreviousStep)
+	{
+		std::shared_ptr<back_testing_data> backTestingData{ create_back_testing_data(
+			{ trade_update{ 40, 1, 1 }, trade_update{ 90, 2, 1 }, trade_update{ 100, 3, 1 }, trade_update{ 130, 4, 1 }, trade_update{ 160, 5, 1 } }) };
+
+		trade_range trades{ backTestingData->get_new_trades(TEST_PAIR) };
+		ASSERT_EQ(2, trades.size());
+		assert_trade_update_eq(trade_update{ 90, 2, 1 }, trades[0]);
+		assert_trade_update_eq(trade_update{ 100, 3, 1 }, backTestingData->get_trade(TEST_PAIR));
+
+		backTestingData->increment();
+
+		trades = backTestingData->get_new_trades(TEST_PAIR);
+		ASSERT_EQ(2, trades.size());
+		assert_trade_update_eq(trade_update{ 130, 4, 1 }, trades[0]);
+		assert_trade_update_eq(trade_update{ 160, 5, 1 }, trades[1]);
+
+		backTestingData->increment();
+
+		EXPECT_TRUE(backTestingData->get_new_trades(TEST_PAIR).empty());
+		assert_trade_update_eq(trade_update{ 160, 5, 1 }, backTestingData->get_trade(TEST_PAIR));
+	}
+
+	TEST_F(TradeColumnFileTest, StreamReplaysEveryTradeAndFillsAtTradePrice)
+	{
+		std::shared_ptr<back_testing_data> backTestingData{ create_back_testing_data(
+			{ trade_update{ 100, 10, 1 }, trade_update{ 120, 8, 1 }, trade_update{ 120, 9, 1 }, trade_update{ 150, 12, 1 } }) };
+
+		auto stream = std::make_shared<backtest_websocket_stream>(backTestingData);
+		paper_trade_api paperTradeApi{ paper_trading_config{ 0, { { "GBP", 100 } } }, stream, "BACK_TEST", [backTestingData]() { return backTestingData->data_time(); } };
+
+		std::vector<double> prices;
+		stream->add_trade_update_handler([&prices](trade_update_message message) { prices.push_back(message.trade().price()); });
+
+		stream->notify();
+		paperTradeApi.add_order(create_limit_order(TEST_PAIR, trade_action::BUY, 8.5, 1));
+
+		backTestingData->increment();
+		stream->notify();
+
+		EXPECT_EQ((std::vector<double>{ 8, 9, 12 }), prices);
+		EXPECT_EQ(3, stream->get_trade_history(TEST_PAIR)->get_trades().size());
+		ASSERT_EQ(1, paperTradeApi.get_closed_orders().size());
+		EXPECT_DOUBLE_EQ(91.5, paperTradeApi.get_balances().at("GBP"));
+	}
+
+	TEST_F(TradeColumnFileTest, DISABLED_BenchmarkReplayTrades)
+	{
+		constexpr int tradeCount = 10000000;
+		constexpr int stepSize = 60;
+
+		std::vector<trade_update> recordedTrades;
+		recordedTrades.reserve(tradeCount);
+
+		for (int i = 0; i < tradeCount; ++i)
+		{
+			recordedTrades.emplace_back(i / 100, 100.0 + i % 7, 0.01);
+		}
+
+		write_trade_column_file(_path, std::move(recordedTrades));
+
+		int steps{ tradeCount / 100 / stepSize + 1 };
+		auto backTestingData = std::make_shared<back_testing_data>(
+			std::vector<tradable_pair>{ TEST_PAIR },
+			std::unordered_map<tradable_pair, std::vector<ohlcv_data>>{},
+			0,
+			(steps - 1) * stepSize,
+			stepSize,
+			steps);
+
+		backTestingData->set_trades(TEST_PAIR, load_trade_column_file(_directory, TEST_PAIR));
+
+		auto stream = std::make_shared<backtest_websocket_stream>(backTestingData);
+		paper_trade_api paperTradeApi{ paper_trading_config{ 0, { { "GBP", 100 } } }, stream, "BACK_TEST", [backTestingData]() { return backTestingData->data_time(); } };
+		paperTradeApi.add_order(create_limit_order(TEST_PAIR, trade_action::BUY, 1, 1));
+
+		auto start = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < steps; ++i)
+		{
+			stream->notify();
+			backTestingData->increment();
+		}
+
+		std::chrono::duration<double> elapsed{ std::chrono::steady_clock::now() - start };
+
+		std::cout << "Replayed " << tradeCount << " trades in " << elapsed.count() << "s ("
+			<< static_cast<long long>(tradeCount / elapsed.count() * 60) << " trades per minute)\n";
+	}
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+
+#include "testing/back_testing/ohlcv_range_index.h"
+#include "testing/back_testing/back_testing_data.h"
+#include "mbtest/assertion_helpers.h"
+
+namespace
+{
+	using namespace mb;
+
+	std::vector<ohlcv_data> create_random_data(int count, int stepSize)
+	{
+		std::mt19937 generator{ 42 };
+		std::uniform_real_distribution<double> prices{ 1, 100 };
+		std::uniform_int_distribution<int> volumes{ 1, 1000 };
+
+		std::vector<ohlcv_data> data;
+		data.reserve(count);
+
+		for (int i = 0; i < count; ++i)
+		{
+			data.emplace_back(i * stepSize, prices(generator), prices(generator), prices(generator), prices(generator), volumes(generator));
+		}
+
+		return data;
+	}
+
+	ohlcv_data merge_rows(const std::vector<ohlcv_data>& data, size_t start, size_t end, std::time_t timeStamp)
+	{
+		double high = data[start].high();
+		double low = data[start].low();
+		double volume = 0;
+
+		for (size_t i = start; i < end; ++i)
+		{
+			high = std::max(high, data[i].high());
+			low = std::min(low, data[i].low());
+			volume += data[i].volume();
+		}
+
+		return ohlcv_data{ timeStamp, data[start].open(), high, low, data[end - 1].close(), volume };
+	}
+}
+
+namespace mb::test
+{
+	TEST(OhlcvRangeIndex, MergeMatchesMergingEveryRow)
+	{
+		std::vector<ohlcv_data> data{ create_random_data(40, 60) };
+		ohlcv_range_index index{ data };
+
+		for (size_t start = 0; start < data.size(); ++start)
+		{
+			for (size_t end = start + 1; end <= data.size(); ++end)
+			{
+				assert_ohlcv_data_eq(merge_rows(data, start, end, 7), index.merge(start, end, 7));
+			}
+		}
+	}
+
+	TEST(OhlcvRangeIndex, LongIntervalCandlesMatchMergedRows)
+	{
+		constexpr int stepSize = 60;
+		constexpr int interval = 3600;
+		tradable_pair pair{ "BTC", "GBP" };
+		std::vector<ohlcv_data> data{ create_random_data(1000, stepSize) };
+
+		back_testing_data backTestingData
+		{
+			std::vector<tradable_pair>{ pair },
+			std::unordered_map<tradable_pair, std::vector<ohlcv_data>>{ { pair, data } },
+			0,
+			999 * stepSize,
+			stepSize,
+			1000
+		};
+
+		for (int i = 0; i < 500; ++i)
+		{
+			backTestingData.increment();
+		}
+
+		std::vector<ohlcv_data> candles{ backTestingData.get_ohlcv(pair, interval, 5) };
+		ASSERT_EQ(5, candles.size());
+
+		size_t end = 500;
+		for (int i = 0; i < 5; ++i)
+		{
+			size_t start = end - interval / stepSize;
+			assert_ohlcv_data_eq(merge_rows(data, start, end, data[start].time_stamp()), candles[i]);
+			end = start;
+		}
+	}
+
+	TEST(OhlcvRangeIndex, DISABLED_BenchmarkHourlyCandlesOnMinuteData)
+	{
+		constexpr int stepSize = 60;
+		constexpr int rowCount = 100000;
+		constexpr int steps = 10000;
+		tradable_pair pair{ "BTC", "GBP" };
+
+		back_testing_data backTestingData
+		{
+			std::vector<tradable_pair>{ pair },
+			std::unordered_map<tradable_pair, std::vector<ohlcv_data>>{ { pair, create_random_data(rowCount, stepSize) } },
+			(rowCount - steps) * stepSize,
+			(rowCount - 1) * stepSize,
+			stepSize,
+			steps
+		};
+
+		auto start = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < steps; ++i)
+		{
+			backTestingData.get_ohlcv(pair, 3600, 200);
+			backTestingData.increment();
+		}
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+		std::cout << "200 hourly candles on minute data: " << elapsed.count() / steps << "us per step\n";
+	}
+}
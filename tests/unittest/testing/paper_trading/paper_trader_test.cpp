@@ -98,6 +98,33 @@ namespace mb::test
 		EXPECT_THROW(this->_paperTradeApi->add_order(orderRequest), mb_exception);
 	}
 
+	TEST_F(PaperTradeApiTest, AddOrderAsyncCompletesBeforeReturning)
+	{
+		order_request orderRequest{ create_market_order(this->_pair, trade_action::BUY, 2.0) };
+		std::future<std::string> orderId{ this->_paperTradeApi->add_order_async(orderRequest) };
+
+		ASSERT_EQ(std::future_status::ready, orderId.wait_for(std::chrono::seconds{ 0 }));
+		EXPECT_EQ(order_status::CLOSED, this->_paperTradeApi->get_order_status(orderId.get()));
+	}
+
+	TEST_F(PaperTradeApiTest, AddOrderAsyncStoresErrorInFuture)
+	{
+		order_request orderRequest{ create_market_order(this->_pair, trade_action::BUY, 10) };
+		std::future<std::string> orderId{ this->_paperTradeApi->add_order_async(orderRequest) };
+
+		EXPECT_THROW(orderId.get(), mb_exception);
+	}
+
+	TEST_F(PaperTradeApiTest, CancelOrderAsyncRemovesOpenOrder)
+	{
+		order_request orderRequest{ create_limit_order(this->_pair, trade_action::BUY, 15.0, 1.0) };
+		std::string orderId{ this->_paperTradeApi->add_order(orderRequest) };
+
+		this->_paperTradeApi->cancel_order_async(orderId).get();
+
+		EXPECT_TRUE(this->_paperTradeApi->get_open_orders().empty());
+	}
+
 	TEST_F(PaperTradeApiTest, BuyLimitOrderExecutesWhenPriceLessThanLimitPrice)
 	{
 		order_request orderRequest{ create_limit_order(this->_pair, trade_action::BUY, 10.0, 1.0) };
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "mbtest/assertion_helpers.h"
+#include "trading/trade_history.h"
+
+namespace mb::test
+{
+	TEST(TradeHistory, GetTradesReturnsEmptyVectorIfNoTradesPushed)
+	{
+		trade_history history{ 3 };
+
+		EXPECT_TRUE(history.get_trades().empty());
+		EXPECT_EQ(0, history.size());
+	}
+
+	TEST(TradeHistory, GetTradesReturnsMostRecentFirst)
+	{
+		trade_history history{ 3 };
+
+		history.push(trade_update{ 1, 1.0, 2.0 });
+		history.push(trade_update{ 2, 3.0, 4.0 });
+
+		std::vector<trade_update> trades{ history.get_trades() };
+
+		ASSERT_EQ(2, trades.size());
+		assert_trade_update_eq(trade_update{ 2, 3.0, 4.0 }, trades[0]);
+		assert_trade_update_eq(trade_update{ 1, 1.0, 2.0 }, trades[1]);
+	}
+
+	TEST(TradeHistory, PushingBeyondCapacityOverwritesOldestTrades)
+	{
+		trade_history history{ 3 };
+
+		for (int i = 1; i <= 5; ++i)
+		{
+			history.push(trade_update{ i, static_cast<double>(i), 1.0 });
+		}
+
+		std::vector<trade_update> trades{ history.get_trades() };
+
+		ASSERT_EQ(3, history.size());
+		ASSERT_EQ(3, trades.size());
+		assert_trade_update_eq(trade_update{ 5, 5.0, 1.0 }, trades[0]);
+		assert_trade_update_eq(trade_update{ 4, 4.0, 1.0 }, trades[1]);
+		assert_trade_update_eq(trade_update{ 3, 3.0, 1.0 }, trades[2]);
+	}
+
+	TEST(TradeHistory, LastReturnsMostRecentTrade)
+	{
+		trade_history history{ 2 };
+
+		EXPECT_FALSE(history.last().has_value());
+
+		for (int i = 1; i <= 3; ++i)
+		{
+			history.push(trade_update{ i, static_cast<double>(i), 1.0 });
+		}
+
+		ASSERT_TRUE(history.last().has_value());
+		assert_trade_update_eq(trade_update{ 3, 3.0, 1.0 }, *history.last());
+	}
+
+	TEST(TradeHistory, GetTradesReturnsRequestedCount)
+	{
+		trade_history history{ 3 };
+
+		history.push(trade_update{ 1, 1.0, 1.0 });
+		history.push(trade_update{ 2, 2.0, 1.0 });
+		history.push(trade_update{ 3, 3.0, 1.0 });
+
+		std::vector<trade_update> trades{ history.get_trades(2) };
+
+		ASSERT_EQ(2, trades.size());
+		assert_trade_update_eq(trade_update{ 3, 3.0, 1.0 }, trades[0]);
+		assert_trade_update_eq(trade_update{ 2, 2.0, 1.0 }, trades[1]);
+	}
+
+	TEST(TradeHistory, ConcurrentReadsOnlyReturnConsistentTrades)
+	{
+		trade_history history{ 8 };
+		std::atomic_bool writing{ true };
+
+		std::thread writer{ [&history, &writing]()
+			{
+				for (int i = 1; i <= 100000; ++i)
+				{
+					history.push(trade_update{ i, static_cast<double>(i), static_cast<double>(i) });
+				}
+
+				writing = false;
+			} };
+
+		while (writing)
+		{
+			std::vector<trade_update> trades{ history.get_trades() };
+
+			for (int i = 0; i < trades.size(); ++i)
+			{
+				ASSERT_EQ(static_cast<double>(trades[i].time_stamp()), trades[i].price());
+				ASSERT_EQ(trades[i].price(), trades[i].volume());
+
+				if (i > 0)
+				{
+					ASSERT_EQ(trades[i - 1].time_stamp() - 1, trades[i].time_stamp());
+				}
+			}
+		}
+
+		writer.join();
+	}
+}